@@ -0,0 +1,36 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__GENOME_BENCH__HPP
+#define AIMAZE2__GENOME_BENCH__HPP
+#include <Genome.hpp>
+
+namespace aimaze2 {
+
+/*! \brief Access to the private mutations of Genome, for benchmarks only. */
+class GenomeBench {
+ public:
+  static bool AddRndConnection(Genome* ioGenome,
+                               ConfigEvolution::RndEngine* iRndEngine,
+                               InnovationHistory* ioInnovationHistory) {
+    return ioGenome->addRndConnection(iRndEngine, ioInnovationHistory);
+  }
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__GENOME_BENCH__HPP
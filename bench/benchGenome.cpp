@@ -0,0 +1,220 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include <benchmark/benchmark.h>
+#include <GenomeBench.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+
+using aimaze2::ConfigEvolution;
+using aimaze2::Genome;
+using aimaze2::InnovationHistory;
+
+constexpr int kNumInputs = 5;
+constexpr int kNumOutputs = 2;
+constexpr int kMinNumConnections = 10;
+constexpr int kMaxNumConnections = 10000;
+constexpr ConfigEvolution::RndEngine::result_type kSeed = 42;
+
+/*! \brief Builds a genome with exactly iNumConnections connections.
+ *  \note Inputs and outputs are linked first. Then hidden nodes are added
+ *        one by one, each one linked to all inputs and outputs.
+ *        The construction only depends on iNumConnections, therefore
+ *        genomes built with the same ioInnovationHistory share the
+ *        innovation numbers.
+ */
+Genome BuildGenome(const int iNumConnections,
+                   ConfigEvolution::RndEngine* iRndEngine,
+                   InnovationHistory* ioInnovationHistory) {
+  using NodeID = Genome::NodeID;
+
+  std::uniform_real_distribution<float> rndWeight(-1.f, 1.f);
+  Genome genome = Genome::CreateSimpleGenome(::kNumInputs, ::kNumOutputs);
+
+  std::vector<NodeID> inputIDs;
+  std::vector<NodeID> outputIDs;
+  const auto [inputs, numInputs] = genome.getMutableInputNodes();
+  for (int i = 0; i < numInputs; ++i) {
+    inputIDs.push_back(inputs[i].getNodeID());
+  }
+  const auto [outputs, numOutputs] = genome.getMutableOutputNodes();
+  for (int i = 0; i < numOutputs; ++i) {
+    outputIDs.push_back(outputs[i].getNodeID());
+  }
+
+  const auto tryLink = [&](const NodeID iNodeFromID, const NodeID iNodeToID) {
+    if (genome.getNumConnections() < iNumConnections &&
+        genome.canBeLinked(iNodeFromID, iNodeToID)) {
+      genome.addConnection(iNodeFromID,
+                           iNodeToID,
+                           rndWeight(*iRndEngine),
+                           ioInnovationHistory);
+    }
+  };
+
+  for (std::size_t i = 0; genome.getNumConnections() < iNumConnections;
+       ++i) {
+    const NodeID nodeFromID = inputIDs[i % inputIDs.size()];
+    const NodeID nodeToID = outputIDs[i % outputIDs.size()];
+    if (genome.canBeLinked(nodeFromID, nodeToID)) {
+      tryLink(nodeFromID, nodeToID);
+      continue;
+    }
+
+    const NodeID hiddenID =
+        genome.addNode(nodeFromID, nodeToID, ioInnovationHistory, false);
+    for (const NodeID inputID : inputIDs) {
+      tryLink(inputID, hiddenID);
+    }
+    for (const NodeID outputID : outputIDs) {
+      tryLink(hiddenID, outputID);
+    }
+  }
+
+  return genome;
+}
+
+void SetInputs(Genome* ioGenome, ConfigEvolution::RndEngine* iRndEngine) {
+  std::uniform_real_distribution<float> rndValue(0.f, 1.f);
+  auto [inputs, numInputs] = ioGenome->getMutableInputNodes();
+  for (int i = 0; i < numInputs; ++i) {
+    inputs[i].setValue(rndValue(*iRndEngine));
+  }
+}
+
+void ConnectionsArgs(benchmark::internal::Benchmark* ioBenchmark) {
+  ioBenchmark->RangeMultiplier(10)
+      ->Range(::kMinNumConnections, ::kMaxNumConnections)
+      ->ArgName("connections");
+}
+
+/*! \note Reference for the benchmarks which work on a copy of the genome. */
+void BM_GenomeCopy(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  InnovationHistory innovationHistory(0);
+  const Genome genome = ::BuildGenome(
+      static_cast<int>(ioState.range(0)), &rndEngine, &innovationHistory);
+
+  for (auto _ : ioState) {
+    Genome copy = genome;
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+void BM_GenomeFeedForward(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  InnovationHistory innovationHistory(0);
+  Genome genome = ::BuildGenome(
+      static_cast<int>(ioState.range(0)), &rndEngine, &innovationHistory);
+  ::SetInputs(&genome, &rndEngine);
+
+  for (auto _ : ioState) {
+    genome.feedForward();
+    benchmark::DoNotOptimize(
+        genome.getMutableOutputNodes().first->getValueWithActivation());
+  }
+  ioState.SetItemsProcessed(ioState.iterations() *
+                            genome.getNumConnections());
+}
+
+/*! \note Each iteration mutates a fresh copy of the same genome. */
+void BM_GenomeMutate(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  InnovationHistory innovationHistory(0);
+  const Genome genome = ::BuildGenome(
+      static_cast<int>(ioState.range(0)), &rndEngine, &innovationHistory);
+
+  for (auto _ : ioState) {
+    Genome copy = genome;
+    copy.mutate(&rndEngine, &innovationHistory);
+    benchmark::DoNotOptimize(copy);
+  }
+}
+
+/*! \note Each iteration works on a fresh copy of the same genome. */
+void BM_GenomeAddRndConnection(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  InnovationHistory innovationHistory(0);
+  const Genome genome = ::BuildGenome(
+      static_cast<int>(ioState.range(0)), &rndEngine, &innovationHistory);
+
+  for (auto _ : ioState) {
+    Genome copy = genome;
+    benchmark::DoNotOptimize(aimaze2::GenomeBench::AddRndConnection(
+        &copy, &rndEngine, &innovationHistory));
+  }
+}
+
+/*! \note Each iteration works on a fresh copy of the same genome. */
+void BM_GenomeAddNode(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  InnovationHistory innovationHistory(0);
+  const Genome genome = ::BuildGenome(
+      static_cast<int>(ioState.range(0)), &rndEngine, &innovationHistory);
+
+  // Split the last connection: it never comes from the bias node.
+  const auto& connection = genome.getConnections().back();
+  const Genome::NodeID nodeFromID = connection.getNodeFromID();
+  const Genome::NodeID nodeToID = connection.getNodeToID();
+
+  for (auto _ : ioState) {
+    Genome copy = genome;
+    benchmark::DoNotOptimize(
+        copy.addNode(nodeFromID, nodeToID, &innovationHistory, true));
+  }
+}
+
+void BM_GenomeCrossover(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  InnovationHistory innovationHistory(0);
+  const int numConnections = static_cast<int>(ioState.range(0));
+  Genome genomeA =
+      ::BuildGenome(numConnections, &rndEngine, &innovationHistory);
+  Genome genomeB =
+      ::BuildGenome(numConnections * 9 / 10, &rndEngine, &innovationHistory);
+
+  for (auto _ : ioState) {
+    Genome child = Genome::Crossover(&genomeA, &genomeB, &rndEngine);
+    benchmark::DoNotOptimize(child);
+  }
+}
+
+void BM_GenomeIsSameSpecie(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  InnovationHistory innovationHistory(0);
+  const int numConnections = static_cast<int>(ioState.range(0));
+  const Genome genomeA =
+      ::BuildGenome(numConnections, &rndEngine, &innovationHistory);
+  const Genome genomeB =
+      ::BuildGenome(numConnections * 9 / 10, &rndEngine, &innovationHistory);
+
+  for (auto _ : ioState) {
+    benchmark::DoNotOptimize(genomeA.isSameSpecie(genomeB));
+  }
+}
+
+}  // anonymous namespace
+
+BENCHMARK(BM_GenomeCopy)->Apply(::ConnectionsArgs);
+BENCHMARK(BM_GenomeFeedForward)->Apply(::ConnectionsArgs);
+BENCHMARK(BM_GenomeMutate)->Apply(::ConnectionsArgs);
+BENCHMARK(BM_GenomeAddRndConnection)->Apply(::ConnectionsArgs);
+BENCHMARK(BM_GenomeAddNode)->Apply(::ConnectionsArgs);
+BENCHMARK(BM_GenomeCrossover)->Apply(::ConnectionsArgs);
+BENCHMARK(BM_GenomeIsSameSpecie)->Apply(::ConnectionsArgs);
@@ -0,0 +1,91 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include <benchmark/benchmark.h>
+#include <Population.hpp>
+#include <random>
+#include <vector>
+
+namespace {
+
+using aimaze2::ConfigEvolution;
+using aimaze2::Population;
+
+constexpr int kNumInputs = 5;
+constexpr int kNumOutputs = 2;
+constexpr int kMinSizePopulation = 100;
+constexpr int kMaxSizePopulation = 50000;
+constexpr int kNumWarmUpGenerations = 5;
+constexpr ConfigEvolution::RndEngine::result_type kSeed = 42;
+
+/*! \brief Random fitness values, which rank the genomes by their number of
+ *         hidden nodes first.
+ *  \note Genome::Crossover requires the fitter parent to have the most hidden
+ *        nodes, as in a trained population.
+ */
+std::vector<float> RndFitness(const Population& iPopulation,
+                              ConfigEvolution::RndEngine* iRndEngine) {
+  constexpr float kMaxRndFitness = 1000.f;
+  std::uniform_real_distribution<float> rndFitness(0.f, kMaxRndFitness);
+  std::vector<float> fitness(iPopulation.getPopulationSize());
+  for (std::size_t i = 0; i < fitness.size(); ++i) {
+    const auto numHiddenNodes =
+        static_cast<float>(iPopulation.getGenome(i).getNumHiddenNodes());
+    fitness[i] = numHiddenNodes * kMaxRndFitness + rndFitness(*iRndEngine);
+  }
+  return fitness;
+}
+
+/*! \note A few generations are evolved before timing, so that the population
+ *        is made of several species.
+ *        Every iteration evolves a fresh copy of that same population, with
+ *        the same fitness values and seed: the copy is out of the timed
+ *        region.
+ */
+void BM_PopulationNaturalSelection(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  const auto sizePopulation = static_cast<std::size_t>(ioState.range(0));
+
+  Population warmedUp;
+  warmedUp.init(sizePopulation, ::kNumInputs, ::kNumOutputs);
+  for (int i = 0; i < ::kNumWarmUpGenerations; ++i) {
+    warmedUp.setAllFitness(::RndFitness(warmedUp, &rndEngine));
+    warmedUp.naturalSelection(&rndEngine);
+  }
+  warmedUp.setAllFitness(::RndFitness(warmedUp, &rndEngine));
+
+  Population population;
+  for (auto _ : ioState) {
+    ioState.PauseTiming();
+    population = warmedUp;
+    rndEngine.seed(::kSeed);
+    ioState.ResumeTiming();
+
+    population.naturalSelection(&rndEngine);
+  }
+  ioState.SetItemsProcessed(ioState.iterations() * ioState.range(0));
+  ioState.counters["species"] =
+      static_cast<double>(population.getSpeciesSize());
+}
+
+}  // anonymous namespace
+
+BENCHMARK(BM_PopulationNaturalSelection)
+    ->RangeMultiplier(10)
+    ->Range(::kMinSizePopulation, ::kMaxSizePopulation)
+    ->ArgName("genomes")
+    ->Unit(benchmark::kMillisecond);
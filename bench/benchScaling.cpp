@@ -0,0 +1,203 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include <benchmark/benchmark.h>
+#include <GenomeBench.hpp>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace {
+
+using aimaze2::ConfigEvolution;
+using aimaze2::Genome;
+using aimaze2::InnovationHistory;
+
+constexpr int kNumInputs = 5;
+constexpr int kNumOutputs = 2;
+constexpr int kMinNumConnections = 1000;
+constexpr int kMaxNumConnections = 100000;
+constexpr ConfigEvolution::RndEngine::result_type kSeed = 42;
+
+/*! \brief Grows a genome by structural mutations until it has
+ *         iNumConnections connections.
+ *  \note New nodes and new connections come in the same proportion as in
+ *        Genome::mutate. New nodes only split enabled connections towards
+ *        an output: splitting an inner connection shifts the layer of every
+ *        node downstream once per path, which is exponential in the size of
+ *        the genome and would not let it reach the target.
+ *        The growth only depends on iNumConnections, therefore a smaller
+ *        genome is a previous stage of a larger one and they share the
+ *        innovation numbers.
+ */
+Genome GrowGenome(const int iNumConnections) {
+  using NodeID = Genome::NodeID;
+
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  InnovationHistory innovationHistory(0);
+  std::uniform_real_distribution<float> rndProbability(0.f, 1.f);
+  constexpr float kProbabilityNewNode =
+      ConfigEvolution::kProbabilityNewNode /
+      (ConfigEvolution::kProbabilityNewNode +
+       ConfigEvolution::kProbabilityNewConnection);
+
+  Genome genome = Genome::CreateSimpleGenome(::kNumInputs, ::kNumOutputs);
+  const NodeID biasID = genome.getBiasNode().getNodeID();
+  const auto [outputs, numOutputs] = genome.getMutableOutputNodes();
+  const NodeID firstOutputID = outputs[0].getNodeID();
+  const NodeID lastOutputID = outputs[numOutputs - 1].getNodeID();
+
+  const auto trySplit = [&]() {
+    const auto& connections = genome.getConnections();
+    if (connections.empty()) {
+      return false;
+    }
+
+    std::uniform_int_distribution<std::size_t> rndIndex(
+        0, connections.size() - 1);
+    const std::size_t offset = rndIndex(rndEngine);
+    for (std::size_t i = 0; i < connections.size(); ++i) {
+      const auto& connection =
+          connections[(offset + i) % connections.size()];
+      const NodeID nodeFromID = connection.getNodeFromID();
+      const NodeID nodeToID = connection.getNodeToID();
+      if (connection.isEnabled() && nodeFromID != biasID &&
+          nodeToID >= firstOutputID && nodeToID <= lastOutputID) {
+        genome.addNode(nodeFromID, nodeToID, &innovationHistory, true);
+        return true;
+      }
+    }
+    return false;
+  };
+
+  while (genome.getNumConnections() < iNumConnections) {
+    if (rndProbability(rndEngine) < kProbabilityNewNode && trySplit()) {
+      continue;
+    }
+    if (!aimaze2::GenomeBench::AddRndConnection(
+            &genome, &rndEngine, &innovationHistory)) {
+      trySplit();
+    }
+  }
+
+  return genome;
+}
+
+/*! \note Growing the largest genomes takes longer than timing them,
+ *        so each size is grown once and shared by all benchmarks.
+ */
+const Genome& GetGrownGenome(const int iNumConnections) {
+  static std::map<int, Genome> grownGenomes;
+
+  auto it = grownGenomes.find(iNumConnections);
+  if (it == grownGenomes.end()) {
+    it = grownGenomes.emplace(iNumConnections, ::GrowGenome(iNumConnections))
+             .first;
+  }
+  return it->second;
+}
+
+void SetInputs(Genome* ioGenome, ConfigEvolution::RndEngine* iRndEngine) {
+  std::uniform_real_distribution<float> rndValue(0.f, 1.f);
+  auto [inputs, numInputs] = ioGenome->getMutableInputNodes();
+  for (int i = 0; i < numInputs; ++i) {
+    inputs[i].setValue(rndValue(*iRndEngine));
+  }
+}
+
+/*! \note The complexity is fitted on the number of connections.
+ *        bench/main.cpp flags the fits above O(N log N).
+ */
+void ScalingArgs(benchmark::internal::Benchmark* ioBenchmark) {
+  ioBenchmark->RangeMultiplier(10)
+      ->Range(::kMinNumConnections, ::kMaxNumConnections)
+      ->ArgName("connections")
+      ->Unit(benchmark::kMillisecond)
+      ->Complexity();
+}
+
+void BM_ScalingFeedForward(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  Genome genome = ::GetGrownGenome(static_cast<int>(ioState.range(0)));
+  ::SetInputs(&genome, &rndEngine);
+
+  for (auto _ : ioState) {
+    genome.feedForward();
+    benchmark::DoNotOptimize(
+        genome.getMutableOutputNodes().first->getValueWithActivation());
+  }
+  ioState.SetComplexityN(genome.getNumConnections());
+}
+
+/*! \note Each iteration works on a fresh copy of the genome,
+ *        made out of the timed region.
+ */
+void BM_ScalingAddRndConnection(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  InnovationHistory innovationHistory(0);
+  const Genome& genome = ::GetGrownGenome(static_cast<int>(ioState.range(0)));
+
+  for (auto _ : ioState) {
+    ioState.PauseTiming();
+    Genome copy = genome;
+    ioState.ResumeTiming();
+    benchmark::DoNotOptimize(aimaze2::GenomeBench::AddRndConnection(
+        &copy, &rndEngine, &innovationHistory));
+  }
+  ioState.SetComplexityN(genome.getNumConnections());
+}
+
+void BM_ScalingIsValid(benchmark::State& ioState) {
+  const Genome& genome = ::GetGrownGenome(static_cast<int>(ioState.range(0)));
+
+  for (auto _ : ioState) {
+    benchmark::DoNotOptimize(genome.isValid());
+  }
+  ioState.SetComplexityN(genome.getNumConnections());
+}
+
+void BM_ScalingCrossover(benchmark::State& ioState) {
+  ConfigEvolution::RndEngine rndEngine(::kSeed);
+  const int numConnections = static_cast<int>(ioState.range(0));
+  Genome genomeA = ::GetGrownGenome(numConnections);
+  Genome genomeB = ::GetGrownGenome(numConnections * 9 / 10);
+
+  for (auto _ : ioState) {
+    Genome child = Genome::Crossover(&genomeA, &genomeB, &rndEngine);
+    benchmark::DoNotOptimize(child);
+  }
+  ioState.SetComplexityN(numConnections);
+}
+
+void BM_ScalingIsSameSpecie(benchmark::State& ioState) {
+  const int numConnections = static_cast<int>(ioState.range(0));
+  const Genome& genomeA = ::GetGrownGenome(numConnections);
+  const Genome genomeB = ::GetGrownGenome(numConnections * 9 / 10);
+
+  for (auto _ : ioState) {
+    benchmark::DoNotOptimize(genomeA.isSameSpecie(genomeB));
+  }
+  ioState.SetComplexityN(numConnections);
+}
+
+}  // anonymous namespace
+
+BENCHMARK(BM_ScalingFeedForward)->Apply(::ScalingArgs);
+BENCHMARK(BM_ScalingAddRndConnection)->Apply(::ScalingArgs);
+BENCHMARK(BM_ScalingIsValid)->Apply(::ScalingArgs);
+BENCHMARK(BM_ScalingCrossover)->Apply(::ScalingArgs);
+BENCHMARK(BM_ScalingIsSameSpecie)->Apply(::ScalingArgs);
@@ -0,0 +1,79 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include <benchmark/benchmark.h>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+/*! \brief Forwards the results to the default display reporter and keeps
+ *         the benchmarks whose fitted complexity grows faster than
+ *         O(N log N).
+ *  \note Only the benchmarks declared with Complexity() are fitted.
+ */
+class ComplexityReporter : public benchmark::BenchmarkReporter {
+ public:
+  explicit ComplexityReporter(benchmark::BenchmarkReporter* iDisplay)
+      : _display(iDisplay) {}
+
+  bool ReportContext(const Context& iContext) override {
+    return _display->ReportContext(iContext);
+  }
+
+  void ReportRuns(const std::vector<Run>& iRuns) override {
+    _display->ReportRuns(iRuns);
+
+    for (const auto& run : iRuns) {
+      if (!run.report_big_o) {
+        continue;
+      }
+      if (run.complexity == benchmark::oNSquared) {
+        _flagged.push_back(run.run_name.function_name + " N^2");
+      } else if (run.complexity == benchmark::oNCubed) {
+        _flagged.push_back(run.run_name.function_name + " N^3");
+      }
+    }
+  }
+
+  void Finalize() override {
+    _display->Finalize();
+
+    for (const auto& flagged : _flagged) {
+      GetErrorStream() << "***WARNING*** Growth above O(N log N): "
+                       << flagged << '\n';
+    }
+  }
+
+ private:
+  benchmark::BenchmarkReporter* _display;
+  std::vector<std::string> _flagged;
+};
+
+}  // anonymous namespace
+
+int main(int argc, char* argv[]) {
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  ::ComplexityReporter reporter(::benchmark::CreateDefaultDisplayReporter());
+  ::benchmark::RunSpecifiedBenchmarks(&reporter);
+  ::benchmark::Shutdown();
+  return 0;
+}
@@ -0,0 +1,67 @@
+# Turns the files of a directory into constexpr byte arrays.
+#
+# Usage:
+#   cmake -DASSETS_DIR=<directory> -DOUTPUT=<source.cpp> -P EmbedAssets.cmake
+#
+# The generated source defines aimaze2::Assets::FindEmbedded (see
+# src/Assets.hpp), which looks files up by their name in the directory.
+
+if(NOT ASSETS_DIR OR NOT OUTPUT)
+  message(FATAL_ERROR "ASSETS_DIR and OUTPUT must be defined")
+endif()
+
+file(GLOB ASSET_NAMES RELATIVE ${ASSETS_DIR} ${ASSETS_DIR}/*)
+list(SORT ASSET_NAMES)
+
+# CMake regular expressions have no {n} quantifier.
+set(BYTES_PER_LINE "")
+foreach(I RANGE 1 12)
+  string(APPEND BYTES_PER_LINE "0x..,")
+endforeach()
+
+set(ARRAYS "")
+set(ENTRIES "")
+set(INDEX 0)
+foreach(NAME ${ASSET_NAMES})
+  file(READ ${ASSETS_DIR}/${NAME} HEX_CONTENT HEX)
+  string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," BYTES "${HEX_CONTENT}")
+  string(REGEX REPLACE "(${BYTES_PER_LINE})" "\\1\n    " BYTES "${BYTES}")
+  string(APPEND ARRAYS
+    "// ${NAME}\n"
+    "constexpr unsigned char kAsset${INDEX}[] = {\n    ${BYTES}};\n\n")
+  string(APPEND ENTRIES
+    "      {\"${NAME}\", {::kAsset${INDEX}, sizeof(::kAsset${INDEX})}},\n")
+  math(EXPR INDEX "${INDEX} + 1")
+endforeach()
+
+set(CONTENT "// Generated by cmake/EmbedAssets.cmake: do not edit.\n")
+string(APPEND CONTENT
+  "#include \"Assets.hpp\"\n\n"
+  "namespace {\n\n"
+  "${ARRAYS}"
+  "}  // anonymous namespace\n\n"
+  "namespace aimaze2 {\n\n"
+  "Assets::Blob Assets::FindEmbedded(const std::string_view iName) noexcept {\n"
+  "  struct Entry {\n"
+  "    std::string_view _name;\n"
+  "    Blob _blob;\n"
+  "  };\n"
+  "  static constexpr Entry kEntries[] = {\n"
+  "${ENTRIES}"
+  "  };\n\n"
+  "  for (const auto& entry : kEntries) {\n"
+  "    if (entry._name == iName) {\n"
+  "      return entry._blob;\n"
+  "    }\n"
+  "  }\n"
+  "  return Blob{nullptr, 0};\n"
+  "}\n\n"
+  "}  // namespace aimaze2\n")
+
+# Rewrite only on changes, not to rebuild needlessly.
+if(EXISTS ${OUTPUT})
+  file(READ ${OUTPUT} OLD_CONTENT)
+endif()
+if(NOT "${OLD_CONTENT}" STREQUAL "${CONTENT}")
+  file(WRITE ${OUTPUT} "${CONTENT}")
+endif()
@@ -0,0 +1,114 @@
+# Runs a workload and checks its throughput against a baseline file.
+#
+# Usage:
+#   cmake -DNAME=<name> -DWORKLOAD=<executable> -DARGS=<arg1|arg2|...>
+#         -DREGEX=<regex> -DBASELINE_FILE=<file> -DTOLERANCE=<percent>
+#         [-DUPDATE=ON] -P PerfTest.cmake
+#
+# The first group of REGEX captures the throughput in the output of the
+# workload (higher is better). The test fails when the throughput is more
+# than TOLERANCE percent below the baseline.
+# With UPDATE the throughput becomes the new baseline instead.
+#
+# The baseline file has a "<name> <throughput>" line per workload;
+# lines starting with '#' are comments.
+
+if(NOT NAME OR NOT WORKLOAD OR NOT REGEX OR NOT BASELINE_FILE)
+  message(FATAL_ERROR "NAME, WORKLOAD, REGEX and BASELINE_FILE must be defined")
+endif()
+if(NOT DEFINED TOLERANCE)
+  set(TOLERANCE 10)
+endif()
+
+# Truncates a decimal number, possibly in scientific notation, to an integer
+# (CMake has integer arithmetic only).
+function(to_integer VALUE OUTPUT)
+  if(NOT VALUE MATCHES "^([0-9]+)(\\.([0-9]*))?([eE]([+-]?)([0-9]+))?$")
+    message(FATAL_ERROR "'${VALUE}' is not a number")
+  endif()
+  set(INTEGER "${CMAKE_MATCH_1}")
+  set(FRACTION "${CMAKE_MATCH_3}")
+  set(EXPONENT 0)
+  if(NOT "${CMAKE_MATCH_6}" STREQUAL "")
+    math(EXPR EXPONENT "${CMAKE_MATCH_5}${CMAKE_MATCH_6}")
+  endif()
+
+  while(EXPONENT GREATER 0)
+    if(FRACTION STREQUAL "")
+      string(APPEND INTEGER "0")
+    else()
+      string(SUBSTRING "${FRACTION}" 0 1 DIGIT)
+      string(SUBSTRING "${FRACTION}" 1 -1 FRACTION)
+      string(APPEND INTEGER "${DIGIT}")
+    endif()
+    math(EXPR EXPONENT "${EXPONENT} - 1")
+  endwhile()
+
+  string(LENGTH "${INTEGER}" LENGTH)
+  while(EXPONENT LESS 0 AND LENGTH GREATER 0)
+    math(EXPR LENGTH "${LENGTH} - 1")
+    string(SUBSTRING "${INTEGER}" 0 ${LENGTH} INTEGER)
+    math(EXPR EXPONENT "${EXPONENT} + 1")
+  endwhile()
+
+  if(INTEGER STREQUAL "")
+    set(INTEGER 0)
+  endif()
+  math(EXPR INTEGER "${INTEGER}")
+  set(${OUTPUT} ${INTEGER} PARENT_SCOPE)
+endfunction()
+
+string(REPLACE "|" ";" ARGS "${ARGS}")
+execute_process(
+  COMMAND ${WORKLOAD} ${ARGS}
+  OUTPUT_VARIABLE OUTPUT
+  RESULT_VARIABLE RESULT)
+if(NOT RESULT EQUAL 0)
+  message(FATAL_ERROR "${NAME}: the workload failed (${RESULT})\n${OUTPUT}")
+endif()
+if(NOT OUTPUT MATCHES "${REGEX}")
+  message(FATAL_ERROR "${NAME}: no throughput in the output\n${OUTPUT}")
+endif()
+to_integer("${CMAKE_MATCH_1}" THROUGHPUT)
+
+set(BASELINE_LINES "")
+if(EXISTS ${BASELINE_FILE})
+  file(STRINGS ${BASELINE_FILE} BASELINE_LINES)
+endif()
+
+if(UPDATE)
+  set(CONTENT "")
+  set(FOUND NO)
+  foreach(LINE IN LISTS BASELINE_LINES)
+    if(LINE MATCHES "^${NAME} ")
+      set(LINE "${NAME} ${THROUGHPUT}")
+      set(FOUND YES)
+    endif()
+    string(APPEND CONTENT "${LINE}\n")
+  endforeach()
+  if(NOT FOUND)
+    string(APPEND CONTENT "${NAME} ${THROUGHPUT}\n")
+  endif()
+  file(WRITE ${BASELINE_FILE} "${CONTENT}")
+  message(STATUS "${NAME}: baseline set to ${THROUGHPUT}")
+  return()
+endif()
+
+set(BASELINE "")
+foreach(LINE IN LISTS BASELINE_LINES)
+  if(LINE MATCHES "^${NAME} ([0-9]+)$")
+    set(BASELINE ${CMAKE_MATCH_1})
+  endif()
+endforeach()
+if(BASELINE STREQUAL "")
+  message(FATAL_ERROR "${NAME}: no baseline in ${BASELINE_FILE}, "
+                      "build the target perf_baseline to record one")
+endif()
+
+math(EXPR MIN_THROUGHPUT "${BASELINE} * (100 - ${TOLERANCE}) / 100")
+message(STATUS "${NAME}: ${THROUGHPUT} (baseline ${BASELINE}, "
+               "minimum ${MIN_THROUGHPUT})")
+if(THROUGHPUT LESS MIN_THROUGHPUT)
+  message(FATAL_ERROR "${NAME}: throughput ${THROUGHPUT} is more than "
+                      "${TOLERANCE}% below the baseline ${BASELINE}")
+endif()
@@ -16,139 +16,546 @@
 
 */
 #include "AIMaze.hpp"
+#include <sys/resource.h>
+#include <algorithm>
 #include <cassert>
 #include <chrono>
+#include <ctime>
+#include <iomanip>
+#include <numeric>
 #include <iostream>  // TODO(biagio): delete this line as well
 #include "Config.hpp"
+#include "Profiler.hpp"
+#include "Tracer.hpp"
 
 namespace aimaze2 {
 
-void AIMaze::launch() {
-  createAndOpenRender();
+// A deduplicated player plays for all its copies: they must share its
+// control phase, which is given by the index of the player.
+static_assert(!Config::kDeduplicateGenomes ||
+                  Config::kControlPeriodTicks == 1 ||
+                  !Config::kStaggeredControl,
+              "Deduplicated genomes require a control shared by all players");
+
+void AIMaze::launch(const Options& iOptions) {
+  _options = iOptions;
+  Tracer::SetThreadName("Logic");
+  if (Tracer::Start(Config::kTraceFile) == false) {
+    std::cout << "Cannot open the trace file '" << Config::kTraceFile << "'\n";
+  }
+
+  if (!isHeadless()) {
+    createAndOpenRender();
+  }
   initSeedRndEngine();
 
-  _gameScene.init(kSizePopulation, _seed, &_rndEngine);
-  _population.init(kSizePopulation, kNumInputs, kNumOuputs);
+  _population.init(_options._sizePopulation,
+                   GenomeController::kNumInputs,
+                   GenomeController::kNumOutputs);
+  _controlScheduler.init(Config::kControlPeriodTicks,
+                         Config::kStaggeredControl);
+  initGeneration();
   updateGenomeToDraw();
 
   printInfoProgram();
   _epoch = 0;
 
-  sf::Event event;
+  if (!isHeadless()) {
+    startRender();
+  }
+  if constexpr (Config::kTelemetry) {
+    if (_telemetry.open(Config::kTelemetryFile) == false) {
+      std::cout << "Cannot open the telemetry file '"
+                << _telemetry.getFilePath() << "'\n";
+    } else if (_telemetry.getFilePath() != Config::kTelemetryFile) {
+      std::cout << "Telemetry columns differ from '" << Config::kTelemetryFile
+                << "', writing to '" << _telemetry.getFilePath() << "'\n";
+    }
+  }
+  if (!_options._digestLog.empty()) {
+    _digestLog.open(_options._digestLog);
+    if (!_digestLog) {
+      std::cout << "Cannot open the digest log '" << _options._digestLog
+                << "'\n";
+    }
+    _digestLog << "# seed " << _seed << '\n';
+  }
+  if (!_options._metricsSocket.empty()) {
+    if (_metricsServer.open(_options._metricsSocket) == false) {
+      std::cout << "Cannot open the metrics socket '"
+                << _options._metricsSocket << "'\n";
+    }
+  }
+  if constexpr (Config::kPublishSharedScene) {
+    if (_sharedScene.create(Config::kSharedSceneName) == false) {
+      std::cout << "Cannot create the shared scene '"
+                << Config::kSharedSceneName << "'\n";
+    }
+  }
 
-  bool keepRunning = true;
-  while (keepRunning) {
-    if (_renderWindow.pollEvent(event)) {
-      if (event.type == sf::Event::EventType::Closed) {
-        keepRunning = false;
-      }
+  _allocationsLast = AllocationCounter::GetCounts();
+  _turboMode = Config::kTurboMode || _options._benchmark;
+  _accumulatorLogic = 0.f;
+  _clockLogic.restart();
+  _clockPublish.restart();
+  _clockRun.restart();
+  _loopStats.reset();
+
+  while (handleEvents() && !isFinished()) {
+    const int numTicks = update();
+    _numTicksRun += numTicks;
+    _metricsServer.addTicks(numTicks);
+    _metricsServer.setNumPlayersAlive(_gameScene.getNumPlayersAlive());
+
+    // Nobody would look at the snapshots of a benchmark.
+    if (!_options._benchmark && publishSnapshot() &&
+        !Config::kThreadedRendering && !isHeadless()) {
+      drawRender();
     }
 
-    update();
-    drawRender();
+    if (_turboMode == false) {
+      sleepUntilNextDeadline();
+    }
+  }
+
+  stopRender();
+  _sharedScene.detach();
+  _frameExporter.stop();
+  _telemetry.close();
+  _metricsServer.close();
+  _digestLog.close();
+  Tracer::Stop();
 
-    sf::sleep(sf::microseconds(10));
+  if (_options._benchmark) {
+    printBenchmarkResults();
   }
 }
 
+bool AIMaze::isHeadless() const noexcept {
+  return Config::kHeadless || _options._benchmark;
+}
+
+bool AIMaze::isFinished() const noexcept {
+  return _options._numGenerations > 0 && _epoch >= _options._numGenerations;
+}
+
 void AIMaze::createAndOpenRender() {
   _renderWindow.create(
       sf::VideoMode{Config::kWindowWidth, Config::kWindowHeight},
       Config::kWindowTitle);
 }
 
+bool AIMaze::handleEvents() {
+  if (isHeadless()) {
+    return true;
+  }
+
+  sf::Event event;
+  while (_renderWindow.pollEvent(event)) {
+    if (event.type == sf::Event::EventType::Closed) {
+      return false;
+    }
+
+    if (event.type == sf::Event::EventType::KeyPressed &&
+        event.key.code == sf::Keyboard::T) {
+      _turboMode = !_turboMode;
+      _accumulatorLogic = 0.f;
+      _clockLogic.restart();
+      std::cout << "Turbo mode: " << (_turboMode ? "on" : "off") << "\n";
+    }
+  }
+
+  return true;
+}
+
+void AIMaze::sleepUntilNextDeadline() const {
+  static constexpr float kPeriodDraw = 1.f / Config::kFPSRenderDraw;
+
+  const float timeToTick = Config::kPeriodLogicUpdate - _accumulatorLogic -
+                           _clockLogic.getElapsedTime().asSeconds();
+  const float timeToPublish =
+      kPeriodDraw - _clockPublish.getElapsedTime().asSeconds();
+
+  const float timeToSleep = std::min(timeToTick, timeToPublish);
+  if (timeToSleep > 0.f) {
+    sf::sleep(sf::seconds(timeToSleep));
+  }
+}
+
 int AIMaze::update() {
-  static sf::Clock clockUpdate;
-  static float accumulator = 0.f;
+  if (_turboMode) {
+    // As many ticks as possible, in batches to keep events and draws going.
+    _accumulatorLogic =
+        Config::kPeriodLogicUpdate * Config::kNumTicksTurboBatch;
+    _clockLogic.restart();
+  } else {
+    _accumulatorLogic += _clockLogic.restart().asSeconds();
+  }
 
   int numFrame = 0;
-  accumulator += clockUpdate.restart().asSeconds();
-  while (accumulator >= Config::kPeriodLogicUpdate) {
-    _gameScene.update(
-        _population, _population.getGenome(0), _epoch, &_rndEngine);
-
-    if (_gameScene.arePlayersAllDead()) {
-      _population.setAllFitness(_gameScene.getPlayerScores());
-      _population.naturalSelection(&_rndEngine);
-      updateGenomeToDraw();
-      printEpochInfo();
-      ++_epoch;
-      _gameScene.init(kSizePopulation, _seed, &_rndEngine);
-      clockUpdate.restart();
-    } else {
-      setInputsAndFeedPopulation();
-      applyActionPopulation();
+  // The loop stats are reset within the batch when a generation ends.
+  int numFrameStats = 0;
+  while (_accumulatorLogic >= Config::kPeriodLogicUpdate && !isFinished()) {
+    if (Config::kEventDrivenStepping && !_options._lockstep) {
+      int maxTicks =
+          static_cast<int>(_accumulatorLogic / Config::kPeriodLogicUpdate);
+      if (_options._maxTicks > 0) {
+        // Leave the tick reaching the cap to a regular update.
+        const std::size_t ticksToCap =
+            _options._maxTicks - 1 -
+            std::min(_gameScene.getNumTicks(), _options._maxTicks - 1);
+        maxTicks = std::min(maxTicks, static_cast<int>(ticksToCap));
+      }
+      // All the networks must have seen the current inputs already.
+      const bool networksUpToDate =
+          _numTicksStableInputs >=
+          static_cast<std::size_t>(_controlScheduler.getPeriodTicks());
+      int idleTicks = 0;
+      if (networksUpToDate) {
+        Tracer::Span span{"Idle step"};
+        {
+          Profiler::ScopedTimer timer{Profiler::Phase::SCENE_IDLE_STEP};
+          idleTicks = _gameScene.computeIdleTicks(maxTicks);
+          if (idleTicks > 0) {
+            _gameScene.advanceIdle(idleTicks);
+          }
+        }
+        if (idleTicks > 0) {
+          logStateDigest();
+        }
+      }
+      if (idleTicks > 0) {
+        numFrame += idleTicks;
+        _accumulatorLogic -= Config::kPeriodLogicUpdate * idleTicks;
+        continue;
+      }
+    }
+
+    {
+      Tracer::Span span{"Logic tick"};
+      _gameScene.update(&_rndEngine);
+      if (_options._maxTicks > 0 &&
+          _gameScene.getNumTicks() >= _options._maxTicks) {
+        _gameScene.killAllPlayers();
+      }
+      logStateDigest();
+
+      if (_gameScene.arePlayersAllDead()) {
+        _loopStats.addTicks(numFrame + 1 - numFrameStats);
+        numFrameStats = numFrame + 1;
+        const auto fitness = computeGenomesFitness();
+        if constexpr (Config::kAuditControlRate) {
+          _perTickFitness = computePerTickFitness();
+        }
+        exportChampion(fitness);
+        Telemetry::Record record = computeEvaluationRecord(fitness);
+        _population.setAllFitness(fitness);
+        storePlayerOutcomes();
+        _population.naturalSelection(&_rndEngine);
+        const Profiler::Totals profile = Profiler::Collect();
+        if (Config::kTelemetry || _options._memoryReport) {
+          record._memory = computeMemoryReport();
+        }
+        traceGenerationCounters();
+        updateGenomeToDraw();
+        printEpochInfo();
+        printProfile(profile);
+        if (_options._memoryReport) {
+          printMemoryReport(record._memory);
+        }
+        recordTelemetry(profile, &record);
+        publishGenerationMetrics(fitness, profile);
+        _profileLast = profile;
+        _loopStats.reset();
+        ++_epoch;
+        _metricsServer.setGeneration(_epoch);
+        initGeneration();
+        _clockLogic.restart();
+      } else {
+        setInputsAndFeedPopulation();
+        applyActionPopulation();
+      }
     }
 
     ++numFrame;
-    accumulator -= Config::kPeriodLogicUpdate;
+    _accumulatorLogic -= Config::kPeriodLogicUpdate;
   }
 
+  _loopStats.addTicks(numFrame - numFrameStats);
   return numFrame;
 }
 
-bool AIMaze::drawRender() {
-  static constexpr float kPeriodDraw = 1.f / Config::kFPSRenderDraw;
+void AIMaze::initGeneration() {
+  Profiler::ScopedTimer timer{Profiler::Phase::INIT_GENERATION};
+
+  if constexpr (Config::kDeduplicateGenomes) {
+    _population.computeUniqueGenomes(&_playerGenomes, &_genomePlayers);
+  } else {
+    _playerGenomes.resize(_options._sizePopulation);
+    std::iota(_playerGenomes.begin(), _playerGenomes.end(), 0);
+    _genomePlayers = _playerGenomes;
+  }
+
+  GameScene::SeedType seedCourse = _seed;
+  if constexpr (!Config::kFixedObstaclesScene) {
+    seedCourse = _rndEngine();
+  }
+  _gameScene.init(_playerGenomes.size(), seedCourse, &_rndEngine);
+  resetControl();
+  memoizeKnownPlayers();
+  _clockGeneration.restart();
+}
+
+std::vector<float> AIMaze::computeGenomesFitness() const {
+  const auto& scores = _gameScene.getPlayerScores();
 
-  static sf::Clock clockRender;
+  std::vector<float> fitness(_genomePlayers.size());
+  for (std::size_t i = 0; i < _genomePlayers.size(); ++i) {
+    assert(_genomePlayers[i] < scores.size());
+    fitness[i] = scores[_genomePlayers[i]];
+  }
+
+  return fitness;
+}
 
-  if (clockRender.getElapsedTime().asSeconds() >= kPeriodDraw) {
-    _renderWindow.clear(Config::kRenderBackgroundColor);
+void AIMaze::memoizeKnownPlayers() {
+  _numPlayersMemoized = 0;
+  if constexpr (!Config::kMemoizeFitness) {
+    return;
+  }
 
-    _gameScene.draw(&_renderWindow);
+  _playerHashes.resize(_playerGenomes.size());
+  for (std::size_t i = 0; i < _playerGenomes.size(); ++i) {
+    _playerHashes[i] =
+        _population.getGenome(_playerGenomes[i]).computeContentHash();
 
-    _renderWindow.display();
-    clockRender.restart();
+    std::size_t deathTick;
+    if (_fitnessCache.matches(computeCacheKey(i), &deathTick)) {
+      _gameScene.setPlayerMemoized(i, deathTick);
+      ++_numPlayersMemoized;
+    }
+  }
+}
+
+void AIMaze::storePlayerOutcomes() {
+  if constexpr (!Config::kMemoizeFitness) {
+    return;
+  }
+
+  const auto& deathTicks = _gameScene.getPlayerDeathTicks();
+  for (std::size_t i = 0; i < _playerGenomes.size(); ++i) {
+    _fitnessCache.addOutcome(computeCacheKey(i), deathTicks[i]);
+  }
+  _fitnessCache.flush();
+}
+
+void AIMaze::exportChampion(const std::vector<float>& iFitness) {
+  static constexpr int kPeriodExport =
+      std::max(Config::kExportChampionEvery, 1);
+
+  if (Config::kExportChampionEvery <= 0 || _epoch % kPeriodExport != 0) {
+    return;
+  }
+
+  const auto champion = static_cast<std::size_t>(std::distance(
+      iFitness.cbegin(), std::max_element(iFitness.cbegin(), iFitness.cend())));
+  assert(champion < _genomePlayers.size());
+  if (_frameExporter.exportRun(_population.getGenome(champion),
+                               _epoch,
+                               _gameScene.getCourseSeed(),
+                               _genomePlayers[champion]) == false) {
+    std::cout << "  Export of epoch " << _epoch << " skipped: exporter busy\n";
+  }
+}
+
+FitnessCache::Key AIMaze::computeCacheKey(
+    const std::size_t iIndexPlayer) const {
+  assert(iIndexPlayer < _playerHashes.size());
+  return FitnessCache::Key{_playerHashes[iIndexPlayer],
+                           _gameScene.getCourseSeed(),
+                           _controlScheduler.getPeriodTicks(),
+                           _controlScheduler.computePhase(iIndexPlayer)};
+}
+
+bool AIMaze::publishSnapshot() {
+  static constexpr float kPeriodDraw = 1.f / Config::kFPSRenderDraw;
+
+  if (_clockPublish.getElapsedTime().asSeconds() >= kPeriodDraw) {
+    SceneSnapshot* snapshot = _snapshots.getWriteBuffer();
+    _gameScene.takeSnapshot(snapshot);
+
+    const Genome& genome = _population.getGenome(0);
+    const auto& ioNodes = genome.getIONodes();
+    snapshot->_genomeInputs.resize(genome.getNumInputs());
+    for (std::size_t i = 0; i < snapshot->_genomeInputs.size(); ++i) {
+      assert(i < ioNodes.size());
+      snapshot->_genomeInputs[i] = ioNodes[i].getValueWithActivation();
+    }
+    snapshot->_populationSize = _population.getPopulationSize();
+    snapshot->_generationNum = _epoch;
+    snapshot->_genomeDiagram = _genomeToDraw;
+    Tracer::AddCounter("Players alive",
+                       static_cast<double>(snapshot->_numAlive));
+
+    if constexpr (Config::kPublishSharedScene) {
+      _sharedScene.publish(*snapshot);
+    }
+    _snapshots.publish();
+    _clockPublish.restart();
     return true;
   }
 
   return false;
 }
 
+bool AIMaze::drawRender() {
+  if (_snapshots.fetch() == false) {
+    return false;
+  }
+
+  Tracer::Span span{"Render frame"};
+  sf::Clock clockFrame;
+  _renderWindow.clear(Config::kRenderBackgroundColor);
+  _sceneRenderer.draw(_snapshots.getReadBuffer(), &_renderWindow);
+  _renderWindow.display();
+  _loopStats.addFrame(clockFrame.getElapsedTime());
+  return true;
+}
+
+void AIMaze::startRender() {
+  if constexpr (Config::kThreadedRendering) {
+    // The context of the window is going to be activated by the render thread.
+    _renderWindow.setActive(false);
+    _rendering = true;
+    _renderThread = std::thread{&AIMaze::renderLoop, this};
+  } else {
+    _sceneRenderer.init();
+  }
+}
+
+void AIMaze::stopRender() {
+  if (_renderThread.joinable()) {
+    _rendering = false;
+    _renderThread.join();
+    _renderWindow.setActive(true);
+  }
+}
+
+void AIMaze::renderLoop() {
+  Tracer::SetThreadName("Render");
+  _renderWindow.setActive(true);
+  _sceneRenderer.init();
+
+  while (_rendering) {
+    if (drawRender() == false) {
+      sf::sleep(sf::milliseconds(1));
+    }
+  }
+
+  _renderWindow.setActive(false);
+}
+
 void AIMaze::setInputsAndFeedPopulation() {
-  const float gameVelocity = _gameScene.getGameVelocity();
-  const auto& nextObstacleProperty = _gameScene.getNextObstacleProperty();
+  Profiler::ScopedTimer timer{Profiler::Phase::FEED_POPULATION};
+
+  const auto inputs = GenomeController::ComputeInputs(_gameScene);
+  if (inputs == _lastInputs) {
+    ++_numTicksStableInputs;
+  } else {
+    _lastInputs = inputs;
+    _numTicksStableInputs = 1;
+  }
+
+  const std::size_t tick = _gameScene.getNumTicks();
+
+  for (std::size_t i = 0; i < _playerGenomes.size(); ++i) {
+    if (!_gameScene.isPlayerRunning(i)) {
+      continue;
+    }
 
-  for (std::size_t i = 0; i < kSizePopulation; ++i) {
-    auto refGenome = _population.getMutableGenome(i);
-    auto inputNodes = refGenome->getMutableInputNodes();
-    assert(inputNodes.second == kNumInputs);
-    inputNodes.first[0].setValue(gameVelocity);
-    inputNodes.first[1].setValue(nextObstacleProperty._distance);
-    inputNodes.first[2].setValue(nextObstacleProperty._width);
-    inputNodes.first[3].setValue(nextObstacleProperty._height);
-    inputNodes.first[4].setValue(nextObstacleProperty._altitude);
+    const bool isDecisionTick = _controlScheduler.isDecisionTick(i, tick);
+    if (!isDecisionTick && !Config::kAuditControlRate) {
+      continue;
+    }
 
-    refGenome->feedForward();
+    auto refGenome = _population.getMutableGenome(_playerGenomes[i]);
+    const Action action = GenomeController::ComputeAction(inputs, refGenome);
+    if (isDecisionTick) {
+      _heldActions[i] = action;
+      _controlScheduler.addEvaluation();
+    } else {
+      _controlScheduler.addAudit(action != _heldActions[i]);
+    }
   }
 }
 
 void AIMaze::applyActionPopulation() {
-  for (std::size_t i = 0; i < kSizePopulation; ++i) {
-    auto refGenome = _population.getMutableGenome(i);
-    auto outputNodes = refGenome->getMutableOutputNodes();
-    assert(outputNodes.second == kNumOuputs);
+  Profiler::ScopedTimer timer{Profiler::Phase::APPLY_ACTIONS};
 
-    const float jump = outputNodes.first[0].getValueWithActivation();
-    const float duck = outputNodes.first[1].getValueWithActivation();
+  for (std::size_t i = 0; i < _playerGenomes.size(); ++i) {
+    if (!_gameScene.isPlayerRunning(i)) {
+      continue;
+    }
 
-    if (duck > 0.5) {
-      _gameScene.playerDuckOn(i);
-    } else {
-      _gameScene.playerDuckOff(i);
-      if (jump > 0.5) {
-        _gameScene.playerJump(i);
+    GenomeController::ApplyAction(_heldActions[i], i, &_gameScene);
+  }
+}
+
+void AIMaze::resetControl() {
+  _heldActions.assign(_playerGenomes.size(), Action::NONE);
+  _numTicksStableInputs = 0;
+  _controlScheduler.resetStats();
+}
+
+std::vector<float> AIMaze::computePerTickFitness() {
+  Tracer::Span span{"Per-tick control group"};
+  Profiler::SetThreadExcluded(true);
+
+  // The ground draws its rocks at random: it must not consume _rndEngine.
+  Config::RndEngine rndEngine{_gameScene.getCourseSeed()};
+  GameScene gameScene;
+  gameScene.init(_playerGenomes.size(), _gameScene.getCourseSeed(), &rndEngine);
+
+  while (!gameScene.arePlayersAllDead()) {
+    gameScene.update(&rndEngine);
+    if (_options._maxTicks > 0 &&
+        gameScene.getNumTicks() >= _options._maxTicks) {
+      gameScene.killAllPlayers();
+    }
+
+    const auto inputs = GenomeController::ComputeInputs(gameScene);
+    for (std::size_t i = 0; i < _playerGenomes.size(); ++i) {
+      if (gameScene.isPlayerRunning(i)) {
+        auto refGenome = _population.getMutableGenome(_playerGenomes[i]);
+        GenomeController::ApplyAction(
+            GenomeController::ComputeAction(inputs, refGenome), i, &gameScene);
       }
     }
   }
+
+  Profiler::SetThreadExcluded(false);
+
+  const auto& scores = gameScene.getPlayerScores();
+  std::vector<float> fitness(_genomePlayers.size());
+  for (std::size_t i = 0; i < _genomePlayers.size(); ++i) {
+    fitness[i] = scores[_genomePlayers[i]];
+  }
+  return fitness;
 }
 
 void AIMaze::updateGenomeToDraw() {
-  const Genome& selectedGenome = _population.getGenome(0);
-  _gameScene.updateGenomeToDraw(selectedGenome);
+  // A copy: the render thread must not read the population.
+  _genomeToDraw = std::make_shared<const GenomeDrawner::Diagram>(
+      GenomeDrawner::CreateDiagram(_population.getGenome(0)));
 }
 
 void AIMaze::initSeedRndEngine() {
+  if (_options._seed.has_value()) {
+    _seed = *_options._seed;
+    _rndEngine.seed(_seed);
+    return;
+  }
+
 #ifdef NDEBUG
   _seed = static_cast<Config::RndEngine::result_type>(
       std::chrono::system_clock::now().time_since_epoch().count());
@@ -158,14 +565,274 @@ void AIMaze::initSeedRndEngine() {
   _rndEngine.seed(_seed);
 }
 
+void AIMaze::logStateDigest() {
+  if (!_digestLog.is_open()) {
+    return;
+  }
+
+  _digestLog << _epoch << ' ' << _gameScene.getNumTicks() << ' ' << std::hex
+             << std::setw(16) << std::setfill('0')
+             << _gameScene.computeStateDigest() << std::dec << '\n';
+}
+
 void AIMaze::printInfoProgram() const {
   std::cout << "AIMaze2\n"
             << "Seed RndEngine: " << _seed << "\n"
-            << "Population Size: " << kSizePopulation << "\n";
+            << "Population Size: " << _options._sizePopulation << "\n"
+            << "Press T to toggle turbo mode\n";
+}
+
+void AIMaze::printBenchmarkResults() const {
+  const float elapsed = _clockRun.getElapsedTime().asSeconds();
+
+  // Kilobytes on Linux, bytes on macOS.
+  rusage usage{};
+  getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+  const long peakRSS = usage.ru_maxrss / 1024;
+#else
+  const long peakRSS = usage.ru_maxrss;
+#endif
+
+  std::cout << "Benchmark\n"
+            << "  Generations: " << _epoch << "\n"
+            << "  Ticks: " << _numTicksRun << "\n"
+            << "  Wall time: " << elapsed << " s\n"
+            << "  Ticks/s: "
+            << static_cast<std::uint64_t>(
+                   static_cast<float>(_numTicksRun) / elapsed)
+            << "\n"
+            << "  Generations/s: " << static_cast<float>(_epoch) / elapsed
+            << "\n"
+            << "  Peak RSS: " << peakRSS << " KiB\n"
+            << "  Event-driven stepping: "
+            << (Config::kEventDrivenStepping && !_options._lockstep ? "on"
+                                                                    : "off")
+            << "\n";
 }
 
 void AIMaze::printEpochInfo() const {
-  std::cout << "  Epoch " << _epoch << "\n";
+  const auto scores = computeGenomesFitness();
+  const float maxScore = *std::max_element(scores.cbegin(), scores.cend());
+  const float meanScore = std::accumulate(scores.cbegin(), scores.cend(), 0.f) /
+                          static_cast<float>(scores.size());
+
+  std::cout << "  Epoch " << _epoch << "\n"
+            << "    Ticks: " << _gameScene.getNumTicks()
+            << " (idle: " << _gameScene.getNumIdleTicks() << ")\n"
+            << "    Score max: " << maxScore << ", mean: " << meanScore << "\n"
+            << "    Unique genomes: " << _playerGenomes.size()
+            << " (memoized: " << _numPlayersMemoized << ")\n"
+            << "    Network evaluations: "
+            << _controlScheduler.getNumEvaluations()
+            << " (period: " << _controlScheduler.getPeriodTicks() << ")\n"
+            << "    Tick rate: " << _loopStats.computeTickRate() << " ticks/s"
+            << (_turboMode ? " (turbo)" : "") << "\n"
+            << "    Frame time: " << _loopStats.computeMeanFrameTime()
+            << " ms mean, " << _loopStats.getMaxFrameTime() << " ms max ("
+            << _loopStats.getNumFrames() << " frames)\n";
+
+  if constexpr (Config::kAuditControlRate) {
+    // Positive when the control rate scores more than per-tick control.
+    const float maxScorePerTick =
+        *std::max_element(_perTickFitness.cbegin(), _perTickFitness.cend());
+    const float meanScorePerTick =
+        std::accumulate(
+            _perTickFitness.cbegin(), _perTickFitness.cend(), 0.f) /
+        static_cast<float>(_perTickFitness.size());
+    std::cout << "    Score vs per-tick control: max "
+              << maxScore - maxScorePerTick << ", mean "
+              << meanScore - meanScorePerTick << "\n";
+
+    const std::size_t numAudits = _controlScheduler.getNumAudits();
+    const std::size_t numMismatches = _controlScheduler.getNumMismatches();
+    const float agreement =
+        numAudits ? 1.f - static_cast<float>(numMismatches) /
+                              static_cast<float>(numAudits)
+                  : 1.f;
+    std::cout << "    Agreement with per-tick control: " << agreement * 100.f
+              << "%\n";
+  }
+}
+
+void AIMaze::traceGenerationCounters() const {
+  if constexpr (!Tracer::kEnabled) {
+    return;
+  }
+
+  std::size_t numConnections = 0;
+  std::size_t numNodes = 0;
+  for (std::size_t i = 0; i < _population.getPopulationSize(); ++i) {
+    const Genome& genome = _population.getGenome(i);
+    numConnections += static_cast<std::size_t>(genome.getNumConnections());
+    numNodes += static_cast<std::size_t>(genome.getTotalNumNodes());
+  }
+  const auto sizePopulation =
+      static_cast<double>(_population.getPopulationSize());
+
+  Tracer::AddCounter("Species",
+                     static_cast<double>(_population.getSpeciesSize()));
+  Tracer::AddCounter("Genome connections (mean)",
+                     static_cast<double>(numConnections) / sizePopulation);
+  Tracer::AddCounter("Genome nodes (mean)",
+                     static_cast<double>(numNodes) / sizePopulation);
+}
+
+Telemetry::Record AIMaze::computeEvaluationRecord(
+    const std::vector<float>& iFitness) const {
+  Telemetry::Record record;
+  if constexpr (!Config::kTelemetry) {
+    return record;
+  }
+
+  record._seed = _seed;
+  record._generationNum = _epoch;
+  record._numTicks = _gameScene.getNumTicks();
+  record._numIdleTicks = _gameScene.getNumIdleTicks();
+  record._wallTime = _clockGeneration.getElapsedTime().asSeconds();
+  record._cpuTime = static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+
+  std::vector<float> fitness = iFitness;
+  const auto median = fitness.begin() + fitness.size() / 2;
+  std::nth_element(fitness.begin(), median, fitness.end());
+  record._fitnessMedian = *median;
+  record._fitnessMax = *std::max_element(fitness.cbegin(), fitness.cend());
+  record._fitnessMean =
+      std::accumulate(fitness.cbegin(), fitness.cend(), 0.f) /
+      static_cast<float>(fitness.size());
+
+  const std::size_t sizePopulation = _population.getPopulationSize();
+  for (std::size_t i = 0; i < sizePopulation; ++i) {
+    const Genome& genome = _population.getGenome(i);
+    record._nodesMax = std::max(record._nodesMax, genome.getTotalNumNodes());
+    record._nodesMean += static_cast<float>(genome.getTotalNumNodes());
+    record._connectionsMax =
+        std::max(record._connectionsMax, genome.getNumConnections());
+    record._connectionsMean += static_cast<float>(genome.getNumConnections());
+    record._layersMax = std::max(record._layersMax, genome.getNumLayers());
+    record._layersMean += static_cast<float>(genome.getNumLayers());
+  }
+  record._nodesMean /= static_cast<float>(sizePopulation);
+  record._connectionsMean /= static_cast<float>(sizePopulation);
+  record._layersMean /= static_cast<float>(sizePopulation);
+
+  return record;
+}
+
+void AIMaze::recordTelemetry(const Profiler::Totals& iProfile,
+                             Telemetry::Record* ioRecord) {
+  if constexpr (!Config::kTelemetry) {
+    return;
+  }
+
+  const auto& speciesSizes = _population.getSpeciesSizesFound();
+  ioRecord->_numSpeciesFound = speciesSizes.size();
+  if (!speciesSizes.empty()) {
+    ioRecord->_speciesSizeMax =
+        *std::max_element(speciesSizes.cbegin(), speciesSizes.cend());
+    ioRecord->_speciesSizeMean =
+        static_cast<float>(std::accumulate(
+            speciesSizes.cbegin(), speciesSizes.cend(), std::size_t{0})) /
+        static_cast<float>(speciesSizes.size());
+  }
+
+  const auto& species = _population.getSpecies();
+  ioRecord->_numSpecies = species.size();
+  for (const auto& oneSpecies : species) {
+    const int staleness = oneSpecies.getStaleness();
+    ioRecord->_stalenessMax = std::max(ioRecord->_stalenessMax, staleness);
+    ioRecord->_stalenessMean += static_cast<float>(staleness);
+  }
+  if (!species.empty()) {
+    ioRecord->_stalenessMean /= static_cast<float>(species.size());
+  }
+
+  for (std::size_t i = 0; i < Profiler::kNumPhases; ++i) {
+    ioRecord->_phaseTimes[i] =
+        static_cast<double>(iProfile._nanoseconds[i] -
+                            _profileLast._nanoseconds[i]) /
+        1e6;
+    for (std::size_t e = 0; e < PerfCounters::kNumEvents; ++e) {
+      ioRecord->_phaseEvents[i][e] =
+          iProfile._events[i][e] - _profileLast._events[i][e];
+    }
+  }
+
+  _telemetry.record(*ioRecord);
+}
+
+void AIMaze::printProfile(const Profiler::Totals& iProfile) const {
+  if constexpr (!Profiler::kEnabled) {
+    return;
+  }
+
+  // Totals are cumulative: the generation is the difference with the last.
+  std::cout << "    Profile (ms total, us per call):\n";
+  for (std::size_t i = 0; i < Profiler::kNumPhases; ++i) {
+    const std::uint64_t nanoseconds =
+        iProfile._nanoseconds[i] - _profileLast._nanoseconds[i];
+    const std::uint64_t count = iProfile._counts[i] - _profileLast._counts[i];
+    if (count == 0) {
+      continue;
+    }
+
+    std::cout << "      "
+              << Profiler::GetPhaseName(static_cast<Profiler::Phase>(i))
+              << ": " << static_cast<double>(nanoseconds) / 1e6 << " ms, "
+              << static_cast<double>(nanoseconds) / 1e3 /
+                     static_cast<double>(count)
+              << " us\n";
+  }
+}
+
+void AIMaze::publishGenerationMetrics(const std::vector<float>& iFitness,
+                                      const Profiler::Totals& iProfile) {
+  std::array<double, Profiler::kNumPhases> phaseTimes;
+  for (std::size_t i = 0; i < Profiler::kNumPhases; ++i) {
+    phaseTimes[i] = static_cast<double>(iProfile._nanoseconds[i] -
+                                        _profileLast._nanoseconds[i]) /
+                    1e6;
+  }
+
+  _metricsServer.setGenerationResults(
+      *std::max_element(iFitness.cbegin(), iFitness.cend()),
+      _population.getSpeciesSize(),
+      phaseTimes);
+}
+
+MemoryReport AIMaze::computeMemoryReport() {
+  MemoryReport report;
+  _population.computeMemoryUsage(
+      &report._genomes, &report._species, &report._innovationHistory);
+  _gameScene.computeMemoryUsage(&report._players, &report._obstacles);
+
+  const AllocationCounter::Counts allocations = AllocationCounter::GetCounts();
+  report._numAllocations =
+      allocations._numAllocations - _allocationsLast._numAllocations;
+  report._numAllocatedBytes =
+      allocations._numBytes - _allocationsLast._numBytes;
+  _allocationsLast = allocations;
+
+  return report;
+}
+
+void AIMaze::printMemoryReport(const MemoryReport& iReport) const {
+  static constexpr float kKiB = 1024.f;
+
+  std::cout << "    Memory (KiB): genomes "
+            << static_cast<float>(iReport._genomes) / kKiB << ", species "
+            << static_cast<float>(iReport._species) / kKiB
+            << ", innovation history "
+            << static_cast<float>(iReport._innovationHistory) / kKiB
+            << ", players " << static_cast<float>(iReport._players) / kKiB
+            << ", obstacles "
+            << static_cast<float>(iReport._obstacles) / kKiB << "\n";
+
+  if constexpr (AllocationCounter::kEnabled) {
+    std::cout << "    Allocations: " << iReport._numAllocations << " ("
+              << static_cast<float>(iReport._numAllocatedBytes) / kKiB
+              << " KiB)\n";
+  }
 }
 
 }  // namespace aimaze2
@@ -18,41 +18,153 @@
 #ifndef AIMAZE2__AIMAZE__HPP
 #define AIMAZE2__AIMAZE__HPP
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <atomic>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "AllocationCounter.hpp"
+#include "ControlScheduler.hpp"
+#include "FitnessCache.hpp"
+#include "FrameExporter.hpp"
 #include "GameScene.hpp"
+#include "GenomeController.hpp"
+#include "LoopStats.hpp"
+#include "MemoryReport.hpp"
+#include "MetricsServer.hpp"
 #include "Population.hpp"
+#include "Profiler.hpp"
+#include "SceneRenderer.hpp"
+#include "SceneSnapshot.hpp"
+#include "SharedScene.hpp"
+#include "Telemetry.hpp"
+#include "TripleBuffer.hpp"
 
 namespace aimaze2 {
 
 class AIMaze {
  public:
-  void launch();
-
- private:
-  static constexpr int kNumInputs = 5;
-  static constexpr int kNumOuputs = 2;
 #ifdef NDEBUG
-  static constexpr std::size_t kSizePopulation = 500;
+  static constexpr std::size_t kDefaultSizePopulation = 500;
 #else
-  static constexpr std::size_t kSizePopulation = 100;
+  static constexpr std::size_t kDefaultSizePopulation = 100;
 #endif
 
+  struct Options {
+    bool _memoryReport = false;
+
+    /*! \brief Headless and in turbo mode, prints the throughput and exits
+     *         after _numGenerations.
+     */
+    bool _benchmark = false;
+    int _numGenerations = 0;  // 0 is unlimited.
+    std::optional<Config::RndEngine::result_type> _seed;
+    std::size_t _sizePopulation = kDefaultSizePopulation;
+    std::size_t _maxTicks = 0;  // Per generation, 0 is unlimited.
+
+    /*! \brief Steps every tick even with Config::kEventDrivenStepping, to
+     *         compare the throughput with and without idle steps.
+     */
+    bool _lockstep = false;
+    std::string _metricsSocket;  // Empty for no metrics server.
+
+    /*! \brief File where to log the digest of the scene after each tick,
+     *         to find where two runs diverge (see tools/compareDigests.cpp).
+     *  \note Ticks skipped by the event-driven stepping are not logged.
+     */
+    std::string _digestLog;
+  };
+
+  void launch(const Options& iOptions);
+
+ private:
+
+  using Action = GenomeController::Action;
+
+  Options _options;
   sf::RenderWindow _renderWindow;
+  sf::Clock _clockLogic;
+  sf::Clock _clockPublish;
+  float _accumulatorLogic = 0.f;
+  bool _turboMode = Config::kTurboMode;
+  LoopStats _loopStats;
+  Profiler::Totals _profileLast;
+  sf::Clock _clockGeneration;
+  sf::Clock _clockRun;
+  std::size_t _numTicksRun = 0;
+  Telemetry _telemetry;
+  MetricsServer _metricsServer;
+  std::ofstream _digestLog;
+  AllocationCounter::Counts _allocationsLast;
   Config::RndEngine::result_type _seed;
   Config::RndEngine _rndEngine;
   GameScene _gameScene;
   Population _population;
+  ControlScheduler _controlScheduler;
+  std::vector<std::size_t> _playerGenomes;
+  std::vector<std::size_t> _genomePlayers;
+  std::vector<std::size_t> _playerHashes;
+  FitnessCache _fitnessCache;
+  std::size_t _numPlayersMemoized = 0;
+  std::vector<Action> _heldActions;
+  GenomeController::Inputs _lastInputs;
+  std::size_t _numTicksStableInputs = 0;
+  std::vector<float> _perTickFitness;  // With Config::kAuditControlRate.
   int _epoch = 0;
+  std::shared_ptr<const GenomeDrawner::Diagram> _genomeToDraw;
+  TripleBuffer<SceneSnapshot> _snapshots;
+  SharedScene _sharedScene;
+  FrameExporter _frameExporter;
+  SceneRenderer _sceneRenderer;
+  std::thread _renderThread;
+  std::atomic<bool> _rendering = false;
 
+  bool isHeadless() const noexcept;
+  bool isFinished() const noexcept;
   void createAndOpenRender();
+  bool handleEvents();
+  void sleepUntilNextDeadline() const;
   int update();
+  void initGeneration();
+  std::vector<float> computeGenomesFitness() const;
+  void memoizeKnownPlayers();
+  void storePlayerOutcomes();
+  void exportChampion(const std::vector<float>& iFitness);
+  FitnessCache::Key computeCacheKey(const std::size_t iIndexPlayer) const;
+  bool publishSnapshot();
   bool drawRender();
+  void startRender();
+  void stopRender();
+  void renderLoop();
 
   void setInputsAndFeedPopulation();
   void applyActionPopulation();
+  void resetControl();
+
+  /*! \brief Fitness of the genomes of the generation, replayed on the same
+   *         course with the networks evaluated on every tick.
+   *  \note The control group against which the control rate is judged.
+   */
+  std::vector<float> computePerTickFitness();
   void updateGenomeToDraw();
   void initSeedRndEngine();
+  void logStateDigest();
   void printInfoProgram() const;
+  void printBenchmarkResults() const;
   void printEpochInfo() const;
+  void traceGenerationCounters() const;
+  Telemetry::Record computeEvaluationRecord(
+      const std::vector<float>& iFitness) const;
+  void recordTelemetry(const Profiler::Totals& iProfile,
+                       Telemetry::Record* ioRecord);
+  void printProfile(const Profiler::Totals& iProfile) const;
+  void publishGenerationMetrics(const std::vector<float>& iFitness,
+                                const Profiler::Totals& iProfile);
+  MemoryReport computeMemoryReport();
+  void printMemoryReport(const MemoryReport& iReport) const;
 };
 
 }  // namespace aimaze2
@@ -0,0 +1,57 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "AllocationCounter.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::uint64_t> sNumAllocations = 0;
+std::atomic<std::uint64_t> sNumBytes = 0;
+
+}  // anonymous namespace
+
+#ifdef AIMAZE2_COUNT_ALLOCATIONS
+
+// The other forms (array, nothrow) end up calling these ones.
+void* operator new(std::size_t iSize) {
+  ::sNumAllocations.fetch_add(1, std::memory_order_relaxed);
+  ::sNumBytes.fetch_add(iSize, std::memory_order_relaxed);
+  if (void* memory = std::malloc(iSize != 0 ? iSize : 1)) {
+    return memory;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* iMemory) noexcept { std::free(iMemory); }
+
+void operator delete(void* iMemory, std::size_t) noexcept {
+  std::free(iMemory);
+}
+
+#endif  // AIMAZE2_COUNT_ALLOCATIONS
+
+namespace aimaze2 {
+
+AllocationCounter::Counts AllocationCounter::GetCounts() noexcept {
+  return Counts{::sNumAllocations.load(std::memory_order_relaxed),
+                ::sNumBytes.load(std::memory_order_relaxed)};
+}
+
+}  // namespace aimaze2
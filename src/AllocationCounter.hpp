@@ -0,0 +1,48 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__ALLOCATION_COUNTER__HPP
+#define AIMAZE2__ALLOCATION_COUNTER__HPP
+#include <cstdint>
+
+namespace aimaze2 {
+
+/*! \brief Counts the allocations of the whole program.
+ *  \note With AIMAZE2_COUNT_ALLOCATIONS (CMake option COUNT_ALLOCATIONS) the
+ *        global operator new is replaced by one which counts; otherwise
+ *        the counts stay zero.
+ */
+class AllocationCounter {
+ public:
+#ifdef AIMAZE2_COUNT_ALLOCATIONS
+  static constexpr bool kEnabled = true;
+#else
+  static constexpr bool kEnabled = false;
+#endif
+
+  struct Counts {
+    std::uint64_t _numAllocations = 0;
+    std::uint64_t _numBytes = 0;
+  };
+
+  /*! \brief Allocations since the start of the program. */
+  static Counts GetCounts() noexcept;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__ALLOCATION_COUNTER__HPP
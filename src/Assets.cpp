@@ -0,0 +1,44 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "Assets.hpp"
+#include <string>
+
+namespace aimaze2 {
+
+bool Assets::LoadImage(const std::string_view iName, sf::Image* oImage) {
+#ifdef AIMAZE2_EMBEDDED_ASSETS
+  const Blob blob = FindEmbedded(iName);
+  return blob._data != nullptr &&
+         oImage->loadFromMemory(blob._data, blob._size);
+#else
+  return oImage->loadFromFile(std::string{kDirectory} + std::string{iName});
+#endif
+}
+
+bool Assets::LoadFont(const std::string_view iName, sf::Font* oFont) {
+#ifdef AIMAZE2_EMBEDDED_ASSETS
+  // The font keeps reading from the blob, which lives as long as the program.
+  const Blob blob = FindEmbedded(iName);
+  return blob._data != nullptr &&
+         oFont->loadFromMemory(blob._data, blob._size);
+#else
+  return oFont->loadFromFile(std::string{kDirectory} + std::string{iName});
+#endif
+}
+
+}  // namespace aimaze2
@@ -0,0 +1,51 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__ASSETS__HPP
+#define AIMAZE2__ASSETS__HPP
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <string_view>
+
+namespace aimaze2 {
+
+/*! \brief Access to the files of the data directory.
+ *  \note With AIMAZE2_EMBEDDED_ASSETS the files are compiled into the binary
+ *        (see cmake/EmbedAssets.cmake) and nothing is read from disk.
+ *        Otherwise they are read from "data/", relative to the working
+ *        directory.
+ */
+class Assets {
+ public:
+  static bool LoadImage(const std::string_view iName, sf::Image* oImage);
+  static bool LoadFont(const std::string_view iName, sf::Font* oFont);
+
+ private:
+  static constexpr std::string_view kDirectory = "data/";
+
+  struct Blob {
+    const unsigned char* _data;
+    std::size_t _size;
+  };
+
+  /*! \note Defined in the generated source, nullptr if not found. */
+  static Blob FindEmbedded(const std::string_view iName) noexcept;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__ASSETS__HPP
@@ -17,6 +17,9 @@
 */
 #ifndef AIMAZE2__COLLISION_MANAGER__HPP
 #define AIMAZE2__COLLISION_MANAGER__HPP
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <utility>
 #include "Obstacle.hpp"
 #include "Player.hpp"
 
@@ -27,6 +30,24 @@ class CollisionManager {
   template <typename ObstacleContainer>
   static bool playerCollided(const Player& iPlayer,
                              const ObstacleContainer& iObstacleContainer);
+
+  /*! \brief Continuous version of `playerCollided`.
+   *  \note The player and the obstacles are swept along the motion of the
+   *        last logic tick, so fast obstacles cannot tunnel through the
+   *        player at low logic rates.
+   */
+  template <typename ObstacleContainer>
+  static bool playerSweptCollided(const Player& iPlayer,
+                                  const ObstacleContainer& iObstacleContainer);
+
+  /*! \brief Checks whether two boxes intersect while moving linearly.
+   *  \param [in] iBoxA, iBoxB         The boxes at the end of the motion.
+   *  \param [in] iMotionA, iMotionB   The displacement during the motion.
+   */
+  static bool SweptIntersects(const sf::FloatRect& iBoxA,
+                              const sf::Vector2f& iMotionA,
+                              const sf::FloatRect& iBoxB,
+                              const sf::Vector2f& iMotionB) noexcept;
 };
 
 template <typename ObstacleContainer>
@@ -45,6 +66,61 @@ bool CollisionManager::playerCollided(
   return false;
 }
 
+template <typename ObstacleContainer>
+bool CollisionManager::playerSweptCollided(
+    const Player& iPlayer,
+    const ObstacleContainer& iObstacleContainer) {
+  const auto playerBox = iPlayer.getCollisionBox();
+  const auto playerMotion = iPlayer.getLastMotion();
+
+  for (const auto& obstacle : iObstacleContainer) {
+    const auto obstacleBox = obstacle.getCollisionBox();
+    if (SweptIntersects(
+            playerBox, playerMotion, obstacleBox, obstacle.getLastMotion())) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+inline bool CollisionManager::SweptIntersects(
+    const sf::FloatRect& iBoxA,
+    const sf::Vector2f& iMotionA,
+    const sf::FloatRect& iBoxB,
+    const sf::Vector2f& iMotionB) noexcept {
+  // Box A moves relatively to box B, which is still at its start position.
+  const sf::Vector2f motion = iMotionA - iMotionB;
+  const sf::Vector2f startA{iBoxA.left - iMotionA.x, iBoxA.top - iMotionA.y};
+  const sf::Vector2f startB{iBoxB.left - iMotionB.x, iBoxB.top - iMotionB.y};
+
+  float timeEntry = 0.f;
+  float timeExit = 1.f;
+
+  const auto sweepAxis = [&timeEntry, &timeExit](const float iStartA,
+                                                 const float iSizeA,
+                                                 const float iStartB,
+                                                 const float iSizeB,
+                                                 const float iMotion) {
+    if (iMotion == 0.f) {
+      return iStartA < iStartB + iSizeB && iStartB < iStartA + iSizeA;
+    }
+
+    float timeA = (iStartB - (iStartA + iSizeA)) / iMotion;
+    float timeB = (iStartB + iSizeB - iStartA) / iMotion;
+    if (timeA > timeB) {
+      std::swap(timeA, timeB);
+    }
+
+    timeEntry = std::max(timeEntry, timeA);
+    timeExit = std::min(timeExit, timeB);
+    return timeEntry < timeExit;
+  };
+
+  return sweepAxis(startA.x, iBoxA.width, startB.x, iBoxB.width, motion.x) &&
+         sweepAxis(startA.y, iBoxA.height, startB.y, iBoxB.height, motion.y);
+}
+
 }  // namespace aimaze2
 
 #endif  // AIMAZE2__COLLISION_MANAGER__HPP
@@ -31,9 +31,32 @@ class Config {
   static constexpr const char* kWindowTitle = "AIMaze2";
   static inline const sf::Color kRenderBackgroundColor{255, 255, 255};
   static constexpr unsigned int kFPSRenderDraw = 120;
+  static constexpr bool kThreadedRendering = true;
+  static constexpr bool kHeadless = false;
+  static constexpr bool kPublishSharedScene = false;
+  static constexpr const char* kSharedSceneName = "/aimaze2_scene";
+  static constexpr bool kRenderLOD = true;
+  static constexpr std::size_t kNumPlayersDrawnLOD = 16;
   static constexpr unsigned kFPSLogicUpdate = 1000;
   static constexpr float kDeltaTimeLogicUpdate = 1.f / kFPSLogicUpdate;
   static constexpr float kPeriodLogicUpdate = kDeltaTimeLogicUpdate * 0.5f;
+  static constexpr bool kTurboMode = false;
+  static constexpr int kNumTicksTurboBatch = 256;
+  static constexpr bool kEventDrivenStepping = true;
+  static constexpr bool kContinuousCollision = false;  // For low tick rates.
+  static constexpr int kControlPeriodTicks = 1;
+  static constexpr bool kStaggeredControl = true;
+  static constexpr bool kAuditControlRate = false;
+  static constexpr bool kDeduplicateGenomes = true;
+  static constexpr bool kMemoizeFitness = true;
+  static constexpr int kExportChampionEvery = 0;  // Generations, 0 is never.
+  static constexpr const char* kExportDirectory = "frames";
+  static constexpr bool kExportRawRGB = false;
+  static constexpr unsigned int kExportFPS = 30;
+  static constexpr std::size_t kExportMaxTicks = 60 * kFPSLogicUpdate;
+  static constexpr const char* kTraceFile = "aimaze2_trace.json";
+  static constexpr bool kTelemetry = false;
+  static constexpr const char* kTelemetryFile = "aimaze2_telemetry.csv";
   static inline const sf::Color kFillColor{0, 0, 0};
 #ifdef NDEBUG
   static constexpr bool kDrawCollisionBox = false;
@@ -0,0 +1,73 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "ControlScheduler.hpp"
+#include <cassert>
+
+namespace aimaze2 {
+
+void ControlScheduler::init(const int iPeriodTicks,
+                            const bool iStaggered) noexcept {
+  assert(iPeriodTicks > 0);
+  _periodTicks = iPeriodTicks;
+  _staggered = iStaggered;
+  resetStats();
+}
+
+bool ControlScheduler::isDecisionTick(const std::size_t iIndexPlayer,
+                                      const std::size_t iTick) const noexcept {
+  const std::size_t period = static_cast<std::size_t>(_periodTicks);
+  const std::size_t phase = static_cast<std::size_t>(computePhase(iIndexPlayer));
+  return iTick % period == phase;
+}
+
+int ControlScheduler::getPeriodTicks() const noexcept { return _periodTicks; }
+
+int ControlScheduler::computePhase(const std::size_t iIndexPlayer) const
+    noexcept {
+  const std::size_t period = static_cast<std::size_t>(_periodTicks);
+  return _staggered ? static_cast<int>(iIndexPlayer % period) : 0;
+}
+
+void ControlScheduler::resetStats() noexcept {
+  _numEvaluations = 0;
+  _numAudits = 0;
+  _numMismatches = 0;
+}
+
+void ControlScheduler::addEvaluation() noexcept { ++_numEvaluations; }
+
+void ControlScheduler::addAudit(const bool iMismatch) noexcept {
+  ++_numAudits;
+  if (iMismatch) {
+    ++_numMismatches;
+  }
+}
+
+std::size_t ControlScheduler::getNumEvaluations() const noexcept {
+  return _numEvaluations;
+}
+
+std::size_t ControlScheduler::getNumAudits() const noexcept {
+  return _numAudits;
+}
+
+std::size_t ControlScheduler::getNumMismatches() const noexcept {
+  return _numMismatches;
+}
+
+}  // namespace aimaze2
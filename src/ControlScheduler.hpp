@@ -0,0 +1,61 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__CONTROL_SCHEDULER__HPP
+#define AIMAZE2__CONTROL_SCHEDULER__HPP
+#include <cstddef>
+
+namespace aimaze2 {
+
+/*! \brief Decides on which logic ticks each network is evaluated.
+ *  \note Between two evaluations the player holds its last action.
+ *        When staggered, the evaluations of the population are spread
+ *        evenly over the ticks of the period.
+ */
+class ControlScheduler {
+ public:
+  void init(const int iPeriodTicks, const bool iStaggered) noexcept;
+
+  bool isDecisionTick(const std::size_t iIndexPlayer,
+                      const std::size_t iTick) const noexcept;
+
+  int getPeriodTicks() const noexcept;
+  int computePhase(const std::size_t iIndexPlayer) const noexcept;
+
+  void resetStats() noexcept;
+  void addEvaluation() noexcept;
+
+  /*! \brief Records an out-of-schedule evaluation.
+   *  \param [in] iMismatch   Whether its action differs from the held one.
+   */
+  void addAudit(const bool iMismatch) noexcept;
+
+  std::size_t getNumEvaluations() const noexcept;
+  std::size_t getNumAudits() const noexcept;
+  std::size_t getNumMismatches() const noexcept;
+
+ private:
+  int _periodTicks = 1;
+  bool _staggered = true;
+  std::size_t _numEvaluations = 0;
+  std::size_t _numAudits = 0;
+  std::size_t _numMismatches = 0;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__CONTROL_SCHEDULER__HPP
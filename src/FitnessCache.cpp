@@ -0,0 +1,62 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "FitnessCache.hpp"
+#include <utility>
+#include "HashCombine.hpp"
+
+namespace aimaze2 {
+
+bool FitnessCache::Key::operator==(const Key& iKey) const noexcept {
+  return _genomeHash == iKey._genomeHash && _courseSeed == iKey._courseSeed &&
+         _controlPeriod == iKey._controlPeriod &&
+         _controlPhase == iKey._controlPhase;
+}
+
+bool FitnessCache::matches(const Key& iKey, std::size_t* oDeathTick) const {
+  const auto itFinder = _outcomes.find(iKey);
+  if (itFinder == _outcomes.cend()) {
+    return false;
+  }
+
+  if (oDeathTick != nullptr) {
+    *oDeathTick = itFinder->second;
+  }
+  return true;
+}
+
+void FitnessCache::addOutcome(const Key& iKey, const std::size_t iDeathTick) {
+  _nextOutcomes[iKey] = iDeathTick;
+}
+
+void FitnessCache::flush() {
+  _outcomes = std::move(_nextOutcomes);
+  _nextOutcomes.clear();
+}
+
+std::size_t FitnessCache::size() const noexcept { return _outcomes.size(); }
+
+std::size_t FitnessCache::KeyHasher::operator()(const Key& iKey) const
+    noexcept {
+  std::size_t seed = iKey._genomeHash;
+  HashCombine(&seed, iKey._courseSeed);
+  HashCombine(&seed, iKey._controlPeriod);
+  HashCombine(&seed, iKey._controlPhase);
+  return seed;
+}
+
+}  // namespace aimaze2
@@ -0,0 +1,66 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__FITNESS_CACHE__HPP
+#define AIMAZE2__FITNESS_CACHE__HPP
+#include <cstddef>
+#include <unordered_map>
+#include "Config.hpp"
+
+namespace aimaze2 {
+
+/*! \brief Remembers on which tick a genome died on a given course.
+ *  \note The course is deterministic given its seed, so a genome with the
+ *        same content (and the same control schedule) dies on the same tick
+ *        again. Entries not used by the last generation are dropped on
+ *        `flush`, so the cache does not grow beyond the population size.
+ */
+class FitnessCache {
+ public:
+  using SeedType = Config::RndEngine::result_type;
+
+  struct Key {
+    std::size_t _genomeHash;
+    SeedType _courseSeed;
+    int _controlPeriod;
+    int _controlPhase;
+
+    bool operator==(const Key& iKey) const noexcept;
+  };
+
+  bool matches(const Key& iKey, std::size_t* oDeathTick) const;
+
+  /*! \brief Records an outcome; visible to `matches` after `flush`. */
+  void addOutcome(const Key& iKey, const std::size_t iDeathTick);
+
+  void flush();
+
+  std::size_t size() const noexcept;
+
+ private:
+  struct KeyHasher {
+    std::size_t operator()(const Key& iKey) const noexcept;
+  };
+  using Container = std::unordered_map<Key, std::size_t, KeyHasher>;
+
+  Container _outcomes;
+  Container _nextOutcomes;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__FITNESS_CACHE__HPP
@@ -0,0 +1,195 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "FrameExporter.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include "Config.hpp"
+#include "ControlScheduler.hpp"
+#include "GenomeController.hpp"
+#include "Profiler.hpp"
+#include "SceneSnapshot.hpp"
+#include "Tracer.hpp"
+
+namespace {
+
+std::string FormatFileName(const char* iFormat,
+                           const int iGenerationNum,
+                           const std::size_t iNumFrame = 0) {
+  char fileName[64];
+  std::snprintf(fileName, sizeof(fileName), iFormat, iGenerationNum, iNumFrame);
+  return (std::filesystem::path{aimaze2::Config::kExportDirectory} / fileName)
+      .string();
+}
+
+}  // anonymous namespace
+
+namespace aimaze2 {
+
+FrameExporter::~FrameExporter() { stop(); }
+
+bool FrameExporter::exportRun(const Genome& iGenome,
+                              const int iGenerationNum,
+                              const GameScene::SeedType iCourseSeed,
+                              const std::size_t iIndexPlayer) {
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    if (_runs.size() >= kMaxPendingRuns) {
+      return false;
+    }
+    _runs.push_back(Run{iGenome, iGenerationNum, iCourseSeed, iIndexPlayer});
+  }
+  _condition.notify_one();
+
+  if (_thread.joinable() == false) {
+    _stopping = false;
+    _thread = std::thread{&FrameExporter::exportLoop, this};
+  }
+  return true;
+}
+
+void FrameExporter::stop() {
+  if (_thread.joinable() == false) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _stopping = true;
+    _runs.clear();
+  }
+  _condition.notify_one();
+  _thread.join();
+}
+
+void FrameExporter::exportLoop() {
+  Tracer::SetThreadName("Exporter");
+  Profiler::SetThreadExcluded(true);
+  std::filesystem::create_directories(Config::kExportDirectory);
+  if (_renderTexture.create(Config::kWindowWidth, Config::kWindowHeight) ==
+      false) {
+    std::cerr << "FrameExporter: cannot create the render texture\n";
+    return;
+  }
+  _sceneRenderer.init();
+
+  while (true) {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _condition.wait(lock, [this] { return _stopping || !_runs.empty(); });
+    if (_stopping) {
+      return;
+    }
+    Run run = std::move(_runs.front());
+    _runs.pop_front();
+    lock.unlock();
+
+    replay(&run);
+  }
+}
+
+void FrameExporter::replay(Run* ioRun) {
+  static constexpr std::size_t kTicksPerFrame =
+      Config::kFPSLogicUpdate / Config::kExportFPS;
+
+  Tracer::Span span{"Export replay"};
+
+  Config::RndEngine rndEngine{ioRun->_courseSeed};
+  GameScene gameScene;
+  gameScene.init(1, ioRun->_courseSeed, &rndEngine);
+
+  ControlScheduler controlScheduler;
+  controlScheduler.init(Config::kControlPeriodTicks, Config::kStaggeredControl);
+
+  SceneSnapshot snapshot;
+  snapshot._populationSize = 1;
+  snapshot._generationNum = ioRun->_generationNum;
+  snapshot._genomeDiagram = std::make_shared<const GenomeDrawner::Diagram>(
+      GenomeDrawner::CreateDiagram(ioRun->_genome));
+
+  std::ofstream streamRGB;
+  if constexpr (Config::kExportRawRGB) {
+    streamRGB.open(::FormatFileName("gen_%05d.rgb", ioRun->_generationNum),
+                   std::ios::binary);
+  }
+
+  auto action = GenomeController::Action::NONE;
+  std::size_t numFrame = 0;
+  for (std::size_t tick = 0; tick < Config::kExportMaxTicks; ++tick) {
+    gameScene.update(&rndEngine);
+
+    const bool finished = gameScene.arePlayersAllDead();
+    if (!finished && controlScheduler.isDecisionTick(ioRun->_indexPlayer,
+                                                     gameScene.getNumTicks())) {
+      const auto inputs = GenomeController::ComputeInputs(gameScene);
+      action = GenomeController::ComputeAction(inputs, &ioRun->_genome);
+      snapshot._genomeInputs.assign(inputs.cbegin(), inputs.cend());
+    }
+    if (!finished) {
+      GenomeController::ApplyAction(action, 0, &gameScene);
+    }
+
+    if (tick % kTicksPerFrame == 0 || finished) {
+      gameScene.takeSnapshot(&snapshot);
+      _renderTexture.clear(Config::kRenderBackgroundColor);
+      _sceneRenderer.draw(snapshot, &_renderTexture);
+      _renderTexture.display();
+      writeFrame(ioRun->_generationNum,
+                 numFrame++,
+                 streamRGB.is_open() ? &streamRGB : nullptr);
+    }
+
+    if (finished || isStopping()) {
+      break;
+    }
+  }
+}
+
+void FrameExporter::writeFrame(const int iGenerationNum,
+                               const std::size_t iNumFrame,
+                               std::ostream* oStreamRGB) {
+  const sf::Image image = _renderTexture.getTexture().copyToImage();
+
+  if (oStreamRGB == nullptr) {
+    image.saveToFile(
+        ::FormatFileName("gen_%05d_%06zu.png", iGenerationNum, iNumFrame));
+    return;
+  }
+
+  const auto size = image.getSize();
+  const std::size_t numPixels = static_cast<std::size_t>(size.x) * size.y;
+  const std::uint8_t* pixelsRGBA = image.getPixelsPtr();
+  _pixelsRGB.resize(numPixels * 3);
+  for (std::size_t i = 0; i < numPixels; ++i) {
+    _pixelsRGB[i * 3 + 0] = pixelsRGBA[i * 4 + 0];
+    _pixelsRGB[i * 3 + 1] = pixelsRGBA[i * 4 + 1];
+    _pixelsRGB[i * 3 + 2] = pixelsRGBA[i * 4 + 2];
+  }
+  oStreamRGB->write(reinterpret_cast<const char*>(_pixelsRGB.data()),
+                    static_cast<std::streamsize>(_pixelsRGB.size()));
+}
+
+bool FrameExporter::isStopping() {
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _stopping;
+}
+
+}  // namespace aimaze2
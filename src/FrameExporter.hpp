@@ -0,0 +1,90 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__FRAME_EXPORTER__HPP
+#define AIMAZE2__FRAME_EXPORTER__HPP
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "GameScene.hpp"
+#include "Genome.hpp"
+#include "SceneRenderer.hpp"
+
+namespace aimaze2 {
+
+/*! \brief Renders replays of genomes into image files, in background.
+ *  \note Each replay runs the genome alone on the course it was evaluated
+ *        on and writes a frame every few logic ticks, either as numbered PNG
+ *        files or appended to a raw RGB24 stream (one per replay), e.g.:
+ *          ffmpeg -f rawvideo -pix_fmt rgb24 -s 1024x576 -r 30 -i gen.rgb
+ *        Frames are drawn offscreen; still, SFML needs a graphic context.
+ */
+class FrameExporter {
+ public:
+  FrameExporter() = default;
+  FrameExporter(const FrameExporter&) = delete;
+  FrameExporter& operator=(const FrameExporter&) = delete;
+  ~FrameExporter();
+
+  /*! \brief Queues the replay of a genome.
+   *  \param [in] iIndexPlayer  Index of the genome's player during the
+   *                            evaluation (it gives the control phase).
+   *  \return false if too many replays are pending already.
+   */
+  bool exportRun(const Genome& iGenome,
+                 const int iGenerationNum,
+                 const GameScene::SeedType iCourseSeed,
+                 const std::size_t iIndexPlayer);
+
+  /*! \brief Aborts the pending replays and waits for the thread. */
+  void stop();
+
+ private:
+  static constexpr std::size_t kMaxPendingRuns = 4;
+
+  struct Run {
+    Genome _genome;
+    int _generationNum;
+    GameScene::SeedType _courseSeed;
+    std::size_t _indexPlayer;
+  };
+
+  std::thread _thread;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::deque<Run> _runs;
+  bool _stopping = false;
+
+  sf::RenderTexture _renderTexture;
+  SceneRenderer _sceneRenderer;
+  std::vector<std::uint8_t> _pixelsRGB;
+
+  void exportLoop();
+  void replay(Run* ioRun);
+  void writeFrame(const int iGenerationNum,
+                  const std::size_t iNumFrame,
+                  std::ostream* oStreamRGB);
+  bool isStopping();
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__FRAME_EXPORTER__HPP
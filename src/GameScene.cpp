@@ -16,14 +16,20 @@
 
 */
 #include "GameScene.hpp"
+#include <algorithm>
 #include <cassert>
+#include "Profiler.hpp"
+#include "StateDigest.hpp"
 
 namespace aimaze2 {
 
 void GameScene::init(const std::size_t iNumPlayers,
-                     SeedType iSeedObstacles,
+                     const SeedType iSeedObstacles,
                      Config::RndEngine* iRndEngine) {
   _gameVelocity = kInitialGameVelocity;
+  _accumulatorVelocity = 0.f;
+  _numTicks = 0;
+  _numIdleTicks = 0;
 
   _ground.init(iRndEngine);
 
@@ -33,78 +39,161 @@ void GameScene::init(const std::size_t iNumPlayers,
     _players.back().second.init();
   }
   _playerScores.resize(iNumPlayers, 0);
+  _playerDeathTicks.assign(iNumPlayers, 0);
+  _memoizedDeaths.clear();
+  _nextMemoizedDeath = 0;
   _score.init();
 
-  if constexpr (!Config::kFixedObstaclesScene) {
-    iSeedObstacles = (*iRndEngine)();
-  }
+  _courseSeed = iSeedObstacles;
   _obstacleManager.init(iSeedObstacles);
 
   _sceneState = SceneState::RUNNING;
   _numPlayersDead = 0;
 
   computePropertyNextObstacle();
-
-  _infoDrawner.init();
 }
 
-void GameScene::update(const Population& iPopulation,
-                       const Genome& iGenome,
-                       const int iGenerationNum,
-                       Config::RndEngine* iRndEngine) {
+void GameScene::update(Config::RndEngine* iRndEngine) {
   if (_sceneState == SceneState::RUNNING) {
-    updateGameVelocity();
-    _score.update(_gameVelocity);
+    {
+      Profiler::ScopedTimer timer{Profiler::Phase::SCENE_PHYSICS};
+      updateGameVelocity();
+
+      for (auto& [status, player] : _players) {
+        if (status != PlayerStatus::MEMOIZED) {
+          player.update(_gameVelocity);
+        }
+      }
 
-    for (auto& [status, player] : _players) {
-      player.update(_gameVelocity);
+      _ground.update(_gameVelocity, iRndEngine);
+      _obstacleManager.update(_gameVelocity);
     }
 
-    _ground.update(_gameVelocity, iRndEngine);
-    _obstacleManager.update(_gameVelocity);
-
-    for (std::size_t i = 0; i < _players.size(); ++i) {
-      auto& player = _players[i].second;
-      auto& status = _players[i].first;
-
-      if (status == PlayerStatus::RUNNING &&
-          _collisionManager.playerCollided(player,
-                                           _obstacleManager.getObstacles())) {
-        status = PlayerStatus::DEAD;
-
-        _playerScores[i] = _score.getValue();
+    {
+      Profiler::ScopedTimer timer{Profiler::Phase::SCENE_HUD};
+      _score.update(_gameVelocity);
+    }
 
-        auto deadPosition = kPositionPlayerDead;
-        deadPosition.x += kOffsetDeadPosition * _numPlayersDead;
-        player.die(kPositionPlayerDead + deadPosition);
+    {
+      Profiler::ScopedTimer timer{Profiler::Phase::SCENE_COLLISION};
+      for (std::size_t i = 0; i < _players.size(); ++i) {
+        auto& player = _players[i].second;
+        auto& status = _players[i].first;
 
-        ++_numPlayersDead;
+        if (status == PlayerStatus::RUNNING && hasPlayerCollided(player)) {
+          killPlayer(i);
+        }
       }
+      killMemoizedPlayers();
     }
 
-    computePropertyNextObstacle();
-
-    _infoDrawner.update(iPopulation,
-                        _players.size() - _numPlayersDead,
-                        iGenome,
-                        iGenerationNum);
+    {
+      Profiler::ScopedTimer timer{Profiler::Phase::SCENE_SENSORS};
+      computePropertyNextObstacle();
+    }
 
     if (arePlayersAllDead()) {
       _sceneState = SceneState::STOP;
     }
     // TODO(biagio): partition dead
+
+    ++_numTicks;
   }  // if scene is running
 }
 
-void GameScene::draw(sf::RenderWindow* oRender) const {
-  _ground.draw(oRender);
-  _obstacleManager.draw(oRender);
+void GameScene::takeSnapshot(SceneSnapshot* oSnapshot) const {
+  oSnapshot->_groundBatch.clear();
+  oSnapshot->_spriteBatch.clear();
+  oSnapshot->_debugBatch.clear();
+
+  _ground.draw(&oSnapshot->_groundBatch);
+  _obstacleManager.draw(&oSnapshot->_spriteBatch, &oSnapshot->_debugBatch);
+
+  DensityBins densityBins{};
+  std::size_t numPlayersDrawn = 0;
   for (const auto& [status, player] : _players) {
-    player.draw(oRender);
+    if (status != PlayerStatus::RUNNING) {
+      continue;
+    }
+
+    if (!Config::kRenderLOD || numPlayersDrawn < Config::kNumPlayersDrawnLOD) {
+      player.draw(&oSnapshot->_spriteBatch, &oSnapshot->_debugBatch);
+      ++numPlayersDrawn;
+    } else {
+      ++densityBins[ComputeDensityBin(player)];
+    }
+  }
+
+  if constexpr (Config::kRenderLOD) {
+    DrawDensityBar(densityBins, &oSnapshot->_groundBatch);
+    drawDeadStrip(&oSnapshot->_groundBatch);
   }
-  _genomeDrawner.draw(oRender);
-  _score.draw(oRender);
-  _infoDrawner.draw(oRender);
+
+  oSnapshot->_score = _score.getValue();
+  oSnapshot->_numAlive = getNumPlayersAlive();
+}
+
+int GameScene::computeIdleTicks(const int iMaxTicks) const {
+  if (_sceneState != SceneState::RUNNING || _numTicks == 0) {
+    return 0;
+  }
+
+  // Without simulated players alive neither collisions nor decisions matter.
+  const std::size_t numMemoizedAlive =
+      _memoizedDeaths.size() - _nextMemoizedDeath;
+  if (_numPlayersDead + numMemoizedAlive < _players.size()) {
+    // Obstacles only move leftward: once behind the players they are harmless.
+    const float playerLeft = Player::GetCollisionBoxLeft();
+    for (const auto& obstacle : _obstacleManager.getObstacles()) {
+      const auto box = obstacle.getCollisionBox();
+      if (box.left + box.width >= playerLeft) {
+        return 0;
+      }
+    }
+  }
+
+  int numTicks = computeTicksToVelocityIncrement(iMaxTicks);
+  numTicks = _obstacleManager.computeTicksToSpawn(_gameVelocity, numTicks);
+  numTicks = _ground.computeTicksToRegenerate(_gameVelocity, numTicks);
+
+  if (_nextMemoizedDeath < _memoizedDeaths.size()) {
+    const std::size_t deathTick = _memoizedDeaths[_nextMemoizedDeath].first;
+    assert(deathTick > _numTicks);
+    numTicks = static_cast<int>(
+        std::min<std::size_t>(numTicks, deathTick - _numTicks - 1));
+  }
+
+  for (const auto& [status, player] : _players) {
+    if (numTicks == 0) {
+      break;
+    }
+    if (status == PlayerStatus::RUNNING && player.isJumping()) {
+      numTicks = player.computeTicksToLand(numTicks);
+    }
+  }
+
+  return numTicks;
+}
+
+void GameScene::advanceIdle(const int iNumTicks) {
+  assert(iNumTicks <= computeIdleTicks(iNumTicks));
+
+  for (int i = 0; i < iNumTicks; ++i) {
+    _accumulatorVelocity += Config::kDeltaTimeLogicUpdate;
+  }
+  _score.advance(_gameVelocity, iNumTicks);
+
+  for (auto& [status, player] : _players) {
+    if (status != PlayerStatus::MEMOIZED) {
+      player.advance(_gameVelocity, iNumTicks);
+    }
+  }
+
+  _ground.advance(_gameVelocity, iNumTicks);
+  _obstacleManager.advance(_gameVelocity, iNumTicks);
+
+  _numTicks += iNumTicks;
+  _numIdleTicks += iNumTicks;
 }
 
 void GameScene::playerJump(const std::size_t iIndexPlayer) {
@@ -122,16 +211,45 @@ void GameScene::playerDuckOff(const std::size_t iIndexPlayer) {
   _players[iIndexPlayer].second.duckOff();
 }
 
+void GameScene::setPlayerMemoized(const std::size_t iIndexPlayer,
+                                  const std::size_t iDeathTick) {
+  assert(iIndexPlayer < _players.size());
+  assert(_players[iIndexPlayer].first == PlayerStatus::RUNNING);
+  assert(_numTicks == 0 && iDeathTick > 0);
+
+  _players[iIndexPlayer].first = PlayerStatus::MEMOIZED;
+
+  const auto death = std::make_pair(iDeathTick, iIndexPlayer);
+  _memoizedDeaths.insert(
+      std::upper_bound(_memoizedDeaths.begin(), _memoizedDeaths.end(), death),
+      death);
+}
+
+bool GameScene::isPlayerRunning(const std::size_t iIndexPlayer) const
+    noexcept {
+  assert(iIndexPlayer < _players.size());
+  return _players[iIndexPlayer].first == PlayerStatus::RUNNING;
+}
+
 bool GameScene::arePlayersAllDead() const noexcept {
   return _numPlayersDead == _players.size();
 }
 
+std::size_t GameScene::getNumPlayersAlive() const noexcept {
+  return _players.size() - _numPlayersDead;
+}
+
 const std::vector<float>& GameScene::getPlayerScores() const noexcept {
   return _playerScores;
 }
 
-void GameScene::updateGenomeToDraw(const Genome& iGenome) {
-  _genomeDrawner.updateWithGenome(iGenome);
+const std::vector<std::size_t>& GameScene::getPlayerDeathTicks() const
+    noexcept {
+  return _playerDeathTicks;
+}
+
+GameScene::SeedType GameScene::getCourseSeed() const noexcept {
+  return _courseSeed;
 }
 
 const GameScene::ObstacleProperty& GameScene::getNextObstacleProperty() const
@@ -141,17 +259,167 @@ const GameScene::ObstacleProperty& GameScene::getNextObstacleProperty() const
 
 float GameScene::getGameVelocity() const noexcept { return _gameVelocity; }
 
+std::size_t GameScene::getNumTicks() const noexcept { return _numTicks; }
+
+std::size_t GameScene::getNumIdleTicks() const noexcept {
+  return _numIdleTicks;
+}
+
+void GameScene::computeMemoryUsage(std::size_t* oPlayers,
+                                   std::size_t* oObstacles) const noexcept {
+  *oPlayers = _players.capacity() * sizeof(_players.front()) +
+              _playerScores.capacity() * sizeof(float) +
+              _playerDeathTicks.capacity() * sizeof(std::size_t) +
+              _memoizedDeaths.capacity() * sizeof(_memoizedDeaths.front());
+  *oObstacles = _obstacleManager.getObstacles().size() * sizeof(Obstacle);
+}
+
+std::uint64_t GameScene::computeStateDigest() const noexcept {
+  const auto addBox = [](const sf::FloatRect& iBox, StateDigest* ioDigest) {
+    ioDigest->add(iBox.left);
+    ioDigest->add(iBox.top);
+    ioDigest->add(iBox.width);
+    ioDigest->add(iBox.height);
+  };
+
+  StateDigest digest;
+  digest.add(_gameVelocity);
+  digest.add(_accumulatorVelocity);
+  digest.add(static_cast<std::uint64_t>(_score.getValue()));
+
+  for (const auto& [status, player] : _players) {
+    digest.add(static_cast<std::uint64_t>(status));
+    digest.add(player.getPosition().x);
+    digest.add(player.getPosition().y);
+    digest.add(player.getVelocityY());
+    digest.add(static_cast<std::uint64_t>(player.isJumping()));
+    addBox(player.getCollisionBox(), &digest);
+  }
+
+  const auto& obstacles = _obstacleManager.getObstacles();
+  digest.add(static_cast<std::uint64_t>(obstacles.size()));
+  for (const auto& obstacle : obstacles) {
+    addBox(obstacle.getCollisionBox(), &digest);
+  }
+
+  return digest.getValue();
+}
+
 void GameScene::updateGameVelocity() noexcept {
-  constexpr float kTimeToIncrement = 0.2;
   constexpr float kDeltaIncrement = 1.f;
-  static float accumulator = 0.f;  // TODO(biagio): not good for parallel
 
-  if (kTimeToIncrement <= accumulator) {
+  if (kTimeToIncrementVelocity <= _accumulatorVelocity) {
     _gameVelocity += kDeltaIncrement;
-    accumulator -= kTimeToIncrement;
+    _accumulatorVelocity -= kTimeToIncrementVelocity;
+  }
+
+  _accumulatorVelocity += Config::kDeltaTimeLogicUpdate;
+}
+
+int GameScene::computeTicksToVelocityIncrement(const int iMaxTicks) const
+    noexcept {
+  float accumulator = _accumulatorVelocity;
+  for (int i = 0; i < iMaxTicks; ++i) {
+    if (kTimeToIncrementVelocity <= accumulator) {
+      return i;
+    }
+    accumulator += Config::kDeltaTimeLogicUpdate;
   }
 
-  accumulator += Config::kDeltaTimeLogicUpdate;
+  return iMaxTicks;
+}
+
+bool GameScene::hasPlayerCollided(const Player& iPlayer) const {
+  const auto& obstacles = _obstacleManager.getObstacles();
+
+  if constexpr (Config::kContinuousCollision) {
+    return _collisionManager.playerSweptCollided(iPlayer, obstacles);
+  } else {
+    return _collisionManager.playerCollided(iPlayer, obstacles);
+  }
+}
+
+std::size_t GameScene::ComputeDensityBin(const Player& iPlayer) noexcept {
+  static constexpr float kHeightBin =
+      static_cast<float>(Config::kWindowHeight) / kNumDensityBins;
+
+  const float top = std::max(iPlayer.getCollisionBox().top, 0.f);
+  return std::min(static_cast<std::size_t>(top / kHeightBin),
+                  kNumDensityBins - 1);
+}
+
+void GameScene::DrawDensityBar(const DensityBins& iBins, SpriteBatch* oBatch) {
+  static constexpr float kHeightBin =
+      static_cast<float>(Config::kWindowHeight) / kNumDensityBins;
+  static constexpr float kMinAlpha = 40.f;
+
+  const std::size_t maxCount = *std::max_element(iBins.cbegin(), iBins.cend());
+  if (maxCount == 0) {
+    return;
+  }
+
+  const float left =
+      Player::kPlayerPosition.x - kOffsetDensityBar - kWidthDensityBar;
+  for (std::size_t i = 0; i < iBins.size(); ++i) {
+    if (iBins[i] == 0) {
+      continue;
+    }
+
+    const float density =
+        static_cast<float>(iBins[i]) / static_cast<float>(maxCount);
+    sf::Color color = Config::kFillColor;
+    color.a = static_cast<sf::Uint8>(kMinAlpha + (255.f - kMinAlpha) * density);
+    oBatch->addRect(
+        sf::FloatRect{left, kHeightBin * i, kWidthDensityBar, kHeightBin},
+        color);
+  }
+}
+
+void GameScene::drawDeadStrip(SpriteBatch* oBatch) const {
+  if (_numPlayersDead == 0) {
+    return;
+  }
+
+  const float ratioDead = static_cast<float>(_numPlayersDead) /
+                          static_cast<float>(_players.size());
+  oBatch->addRect(sf::FloatRect{kPositionPlayerDead.x,
+                                kPositionPlayerDead.y,
+                                Config::kWindowWidth * ratioDead,
+                                kHeightDeadStrip},
+                  Config::kFillColor);
+}
+
+void GameScene::killPlayer(const std::size_t iIndexPlayer) {
+  auto& [status, player] = _players[iIndexPlayer];
+  status = PlayerStatus::DEAD;
+
+  _playerScores[iIndexPlayer] = _score.getValue();
+  _playerDeathTicks[iIndexPlayer] = _numTicks + 1;
+
+  auto deadPosition = kPositionPlayerDead;
+  deadPosition.x += kOffsetDeadPosition * _numPlayersDead;
+  player.die(kPositionPlayerDead + deadPosition);
+
+  ++_numPlayersDead;
+}
+
+void GameScene::killAllPlayers() {
+  for (std::size_t i = 0; i < _players.size(); ++i) {
+    if (_players[i].first != PlayerStatus::DEAD) {
+      killPlayer(i);
+    }
+  }
+  _sceneState = SceneState::STOP;
+}
+
+void GameScene::killMemoizedPlayers() {
+  const std::size_t currentTick = _numTicks + 1;
+
+  while (_nextMemoizedDeath < _memoizedDeaths.size() &&
+         _memoizedDeaths[_nextMemoizedDeath].first == currentTick) {
+    killPlayer(_memoizedDeaths[_nextMemoizedDeath].second);
+    ++_nextMemoizedDeath;
+  }
 }
 
 void GameScene::computePropertyNextObstacle() noexcept {
@@ -18,15 +18,15 @@
 #ifndef AIMAZE2__GAME_SCENE__HPP
 #define AIMAZE2__GAME_SCENE__HPP
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
 #include <utility>
 #include <vector>
 #include "CollisionManager.hpp"
-#include "GenomeDrawner.hpp"
 #include "Ground.hpp"
-#include "InfoDrawner.hpp"
 #include "ObstacleManager.hpp"
 #include "Player.hpp"
-#include "Population.hpp"
+#include "SceneSnapshot.hpp"
 #include "Score.hpp"
 
 namespace aimaze2 {
@@ -34,7 +34,7 @@ namespace aimaze2 {
 class GameScene {
  public:
   enum class SceneState { RUNNING, STOP };
-  enum class PlayerStatus { RUNNING, DEAD };
+  enum class PlayerStatus { RUNNING, MEMOIZED, DEAD };
   static inline const sf::Vector2f kPositionPlayerDead{0.f, 0.f};
   using SeedType = ObstacleManager::SeedType;
 
@@ -51,46 +51,121 @@ class GameScene {
   };
 
   void init(const std::size_t iNumPlayers,
-            SeedType iSeedObstacles,
+            const SeedType iSeedObstacles,
             Config::RndEngine* iRndEngine);
-  void update(const Population& iPopulation,
-              const Genome& iGenome,
-              const int iGenerationNum,
-              Config::RndEngine* iRndEngine);
-  void draw(sf::RenderWindow* oRender) const;
+  void update(Config::RndEngine* iRndEngine);
+
+  /*! \brief Fills the scene part of the snapshot: sprites and score.
+   *  \note With `Config::kRenderLOD` only the first running players are drawn
+   *        (they all share the highest current score); the others are
+   *        aggregated into a density bar and the dead ones into a strip, so
+   *        the size of the snapshot does not grow with the population.
+   */
+  void takeSnapshot(SceneSnapshot* oSnapshot) const;
+
+  /*! \brief Number of upcoming logic ticks (at most iMaxTicks) in which
+   *         nothing relevant can happen.
+   *  \note That is, until the first tick which:
+   *        - has an obstacle ahead or inside the players' collision band.
+   *        - increments the game velocity (input of the networks).
+   *        - spawns an obstacle or regenerates a rock.
+   *        - lands a jumping player.
+   *        Within those ticks the inputs of the networks are constant, thus
+   *        their decisions (already applied) are constant as well.
+   *        It is always zero for the first tick after `init`.
+   */
+  int computeIdleTicks(const int iMaxTicks) const;
+
+  /*! \brief Advances the scene by iNumTicks ticks in a single step.
+   *  \note The resulting state is identical to iNumTicks calls of `update`
+   *        as long as iNumTicks <= computeIdleTicks(iNumTicks).
+   */
+  void advanceIdle(const int iNumTicks);
 
   void playerJump(const std::size_t iIndexPlayer);
   void playerDuckOn(const std::size_t iIndexPlayer);
   void playerDuckOff(const std::size_t iIndexPlayer);
 
+  /*! \brief The player is not simulated, it just dies at the given tick.
+   *  \note Its outcome is known already (e.g., same genome on the same
+   *        course). It must be called right after `init`.
+   */
+  void setPlayerMemoized(const std::size_t iIndexPlayer,
+                         const std::size_t iDeathTick);
+
+  bool isPlayerRunning(const std::size_t iIndexPlayer) const noexcept;
+
   bool arePlayersAllDead() const noexcept;
-  const std::vector<float>& getPlayerScores() const noexcept;
+  std::size_t getNumPlayersAlive() const noexcept;
 
-  void updateGenomeToDraw(const Genome& iGenome);
+  /*! \brief Ends the run: all the players still alive die at this tick. */
+  void killAllPlayers();
+  const std::vector<float>& getPlayerScores() const noexcept;
+  const std::vector<std::size_t>& getPlayerDeathTicks() const noexcept;
+  SeedType getCourseSeed() const noexcept;
 
   const ObstacleProperty& getNextObstacleProperty() const noexcept;
   float getGameVelocity() const noexcept;
 
+  std::size_t getNumTicks() const noexcept;
+  std::size_t getNumIdleTicks() const noexcept;
+
+  /*! \brief Digest of the state driving the simulation: game velocity,
+   *         score, players (status, position, motion, collision box) and
+   *         obstacles (collision box).
+   *  \note Two scenes have the same digest only if their states are
+   *        bit-identical. Sprite animations are not part of it.
+   */
+  std::uint64_t computeStateDigest() const noexcept;
+
+  /*! \brief Bytes held by the players (with their scores) and obstacles.
+   *  \note Textures are not included: sprites refer to the shared atlas.
+   */
+  void computeMemoryUsage(std::size_t* oPlayers,
+                          std::size_t* oObstacles) const noexcept;
+
  private:
   static constexpr float kInitialGameVelocity = 400.f;
   static constexpr float kOffsetDeadPosition = 10.f;
+  static constexpr float kTimeToIncrementVelocity = 0.2f;
+  static constexpr std::size_t kNumDensityBins = 32;
+  static constexpr float kWidthDensityBar = 6.f;
+  static constexpr float kOffsetDensityBar = 4.f;
+  static constexpr float kHeightDeadStrip = 4.f;
+
+  using DensityBins = std::array<std::size_t, kNumDensityBins>;
 
   void updateGameVelocity() noexcept;
+  int computeTicksToVelocityIncrement(const int iMaxTicks) const noexcept;
 
   void computePropertyNextObstacle() noexcept;
 
+  void killPlayer(const std::size_t iIndexPlayer);
+  void killMemoizedPlayers();
+
+  bool hasPlayerCollided(const Player& iPlayer) const;
+
+  static std::size_t ComputeDensityBin(const Player& iPlayer) noexcept;
+  static void DrawDensityBar(const DensityBins& iBins, SpriteBatch* oBatch);
+  void drawDeadStrip(SpriteBatch* oBatch) const;
+
   float _gameVelocity;
+  float _accumulatorVelocity;
+  std::size_t _numTicks;
+  std::size_t _numIdleTicks;
   Ground _ground;
   std::vector<std::pair<PlayerStatus, Player>> _players;
   std::vector<float> _playerScores;
+  std::vector<std::size_t> _playerDeathTicks;
+  std::vector<std::pair<std::size_t, std::size_t>> _memoizedDeaths;
+  std::size_t _nextMemoizedDeath;
+  SeedType _courseSeed;
   Score _score;
   ObstacleManager _obstacleManager;
   CollisionManager _collisionManager;
   SceneState _sceneState;
   std::size_t _numPlayersDead;
   ObstacleProperty _obstacleProperty;
-  GenomeDrawner _genomeDrawner;
-  InfoDrawner _infoDrawner;
 };
 
 }  // namespace aimaze2
@@ -25,6 +25,7 @@
 #include <stack>
 #include <utility>
 #include <vector>
+#include "HashCombine.hpp"
 
 namespace {
 
@@ -55,6 +56,23 @@ float PerturbeWeight(aimaze2::ConfigEvolution::RndEngine* iRndEngine,
   return iWeight;
 }
 
+bool AreSameNodes(const aimaze2::GeneNode& iNodeA,
+                  const aimaze2::GeneNode& iNodeB) {
+  return iNodeA.getNodeID() == iNodeB.getNodeID() &&
+         iNodeA.getNodeType() == iNodeB.getNodeType() &&
+         iNodeA.getLayerID() == iNodeB.getLayerID() &&
+         iNodeA.isBiasNode() == iNodeB.isBiasNode();
+}
+
+bool AreSameConnections(const aimaze2::GeneConnection& iConnectionA,
+                        const aimaze2::GeneConnection& iConnectionB) {
+  return iConnectionA.getInnovationNum() == iConnectionB.getInnovationNum() &&
+         iConnectionA.getNodeFromID() == iConnectionB.getNodeFromID() &&
+         iConnectionA.getNodeToID() == iConnectionB.getNodeToID() &&
+         iConnectionA.getWeight() == iConnectionB.getWeight() &&
+         iConnectionA.isEnabled() == iConnectionB.isEnabled();
+}
+
 }  // namespace
 
 namespace aimaze2 {
@@ -366,6 +384,53 @@ bool Genome::isSameSpecie(const Genome& iGenome) const {
   return similarity < ConfigEvolution::kThresholdSpeciate;
 }
 
+std::size_t Genome::computeContentHash() const {
+  std::size_t seed = 0;
+  HashCombine(&seed, _numInputs);
+  HashCombine(&seed, _numOutputs);
+
+  for (const auto& node : _geneNodesHidden) {
+    HashCombine(&seed, node.getNodeID());
+    HashCombine(&seed, node.getLayerID());
+  }
+
+  for (const auto& connection : _geneConnections) {
+    HashCombine(&seed, connection.getInnovationNum());
+    HashCombine(&seed, connection.getNodeFromID());
+    HashCombine(&seed, connection.getNodeToID());
+    HashCombine(&seed, connection.getWeight());
+    HashCombine(&seed, connection.isEnabled());
+  }
+
+  return seed;
+}
+
+std::size_t Genome::computeDynamicMemoryUsage() const noexcept {
+  return _geneNodesIO.capacity() * sizeof(GeneNode) +
+         _geneNodesHidden.capacity() * sizeof(GeneNode) +
+         _geneConnections.capacity() * sizeof(GeneConnection);
+}
+
+bool Genome::hasSameContent(const Genome& iGenome) const {
+  return _numInputs == iGenome._numInputs &&
+         _numOutputs == iGenome._numOutputs &&
+         std::equal(_geneNodesIO.cbegin(),
+                    _geneNodesIO.cend(),
+                    iGenome._geneNodesIO.cbegin(),
+                    iGenome._geneNodesIO.cend(),
+                    ::AreSameNodes) &&
+         std::equal(_geneNodesHidden.cbegin(),
+                    _geneNodesHidden.cend(),
+                    iGenome._geneNodesHidden.cbegin(),
+                    iGenome._geneNodesHidden.cend(),
+                    ::AreSameNodes) &&
+         std::equal(_geneConnections.cbegin(),
+                    _geneConnections.cend(),
+                    iGenome._geneConnections.cbegin(),
+                    iGenome._geneConnections.cend(),
+                    ::AreSameConnections);
+}
+
 float Genome::computeSimilaritySpecie(const Genome& iGenomeA,
                                       const Genome& iGenomeB) {
   int numDisjoint = 0;
@@ -391,9 +456,9 @@ float Genome::computeSimilaritySpecie(const Genome& iGenomeA,
       if (itConA->getInnovationNum() == itConB->getInnovationNum()) {
         // same innovation number
         ++numMatching;
+        totalDifference += std::abs(itConA->getWeight() - itConB->getWeight());
         ++itConA;
         ++itConB;
-        totalDifference += std::abs(itConA->getWeight() - itConB->getWeight());
       } else if (itConA->getInnovationNum() < itConB->getInnovationNum()) {
         // A is smaller
         ++numDisjoint;
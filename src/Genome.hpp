@@ -17,6 +17,7 @@
 */
 #ifndef AIMAZE2__GENOME__HPP
 #define AIMAZE2__GENOME__HPP
+#include <cstddef>
 #include <limits>
 #include <utility>
 #include <vector>
@@ -106,7 +107,35 @@ class Genome {
 
   bool isSameSpecie(const Genome& iGenome) const;
 
+  /*! \brief Compatibility distance: excess and disjoint genes, plus the
+   *         mean weight difference of the matching genes.
+   *  \note Connections of both genomes must be sorted by innovation number.
+   *  \see isSameSpecie
+   */
+  static float computeSimilaritySpecie(const Genome& iGenomeA,
+                                       const Genome& iGenomeB);
+
+  /*! \brief Hash of the network (structure, weights and enabled flags).
+   *  \note Values of the nodes are not part of the content.
+   *  \see hasSameContent
+   */
+  std::size_t computeContentHash() const;
+
+  /*! \brief Checks whether two genomes encode exactly the same network.
+   *  \note Two genomes with the same content produce the same outputs
+   *        given the same inputs.
+   */
+  bool hasSameContent(const Genome& iGenome) const;
+
+  /*! \brief Bytes allocated by the genome, from the capacity of its genes.
+   *  \note sizeof(Genome) is not included.
+   */
+  std::size_t computeDynamicMemoryUsage() const noexcept;
+
  private:
+  /*! \note The benchmarks (see bench/) time the private mutation steps. */
+  friend class GenomeBench;
+
   NodeID _nextNodeId = 0;
   int _numLayers = 0;
   int _numInputs = 0;
@@ -160,9 +189,6 @@ class Genome {
   void updateNumLayers();
   std::vector<NodeID> computeAllNodeIDs() const;
   std::vector<NodeID> computeForwardNodes(const NodeID iNodeFromID) const;
-
-  static float computeSimilaritySpecie(const Genome& iGenomeA,
-                                       const Genome& iGenomeB);
 };
 
 }  // namespace aimaze2
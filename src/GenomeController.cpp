@@ -0,0 +1,75 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "GenomeController.hpp"
+#include <cassert>
+
+namespace aimaze2 {
+
+GenomeController::Inputs GenomeController::ComputeInputs(
+    const GameScene& iGameScene) {
+  const float gameVelocity = iGameScene.getGameVelocity();
+  const auto& nextObstacleProperty = iGameScene.getNextObstacleProperty();
+  return Inputs{gameVelocity,
+                nextObstacleProperty._distance,
+                nextObstacleProperty._width,
+                nextObstacleProperty._height,
+                nextObstacleProperty._altitude};
+}
+
+GenomeController::Action GenomeController::ComputeAction(const Inputs& iInputs,
+                                                         Genome* ioGenome) {
+  auto inputNodes = ioGenome->getMutableInputNodes();
+  assert(inputNodes.second == kNumInputs);
+  for (int n = 0; n < kNumInputs; ++n) {
+    inputNodes.first[n].setValue(iInputs[n]);
+  }
+
+  ioGenome->feedForward();
+
+  auto outputNodes = ioGenome->getMutableOutputNodes();
+  assert(outputNodes.second == kNumOutputs);
+
+  const float jump = outputNodes.first[0].getValueWithActivation();
+  const float duck = outputNodes.first[1].getValueWithActivation();
+
+  if (duck > 0.5) {
+    return Action::DUCK;
+  } else if (jump > 0.5) {
+    return Action::JUMP;
+  }
+  return Action::NONE;
+}
+
+void GenomeController::ApplyAction(const Action iAction,
+                                   const std::size_t iIndexPlayer,
+                                   GameScene* ioGameScene) {
+  switch (iAction) {
+    case Action::DUCK:
+      ioGameScene->playerDuckOn(iIndexPlayer);
+      break;
+    case Action::JUMP:
+      ioGameScene->playerDuckOff(iIndexPlayer);
+      ioGameScene->playerJump(iIndexPlayer);
+      break;
+    case Action::NONE:
+      ioGameScene->playerDuckOff(iIndexPlayer);
+      break;
+  }
+}
+
+}  // namespace aimaze2
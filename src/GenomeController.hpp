@@ -0,0 +1,47 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__GENOME_CONTROLLER__HPP
+#define AIMAZE2__GENOME_CONTROLLER__HPP
+#include <array>
+#include "GameScene.hpp"
+#include "Genome.hpp"
+
+namespace aimaze2 {
+
+/*! \brief How a network plays: what it sees and what it does. */
+class GenomeController {
+ public:
+  static constexpr int kNumInputs = 5;
+  static constexpr int kNumOutputs = 2;
+
+  enum class Action { NONE, JUMP, DUCK };
+  using Inputs = std::array<float, kNumInputs>;
+
+  static Inputs ComputeInputs(const GameScene& iGameScene);
+
+  /*! \brief Feeds the inputs forward through the network. */
+  static Action ComputeAction(const Inputs& iInputs, Genome* ioGenome);
+
+  static void ApplyAction(const Action iAction,
+                          const std::size_t iIndexPlayer,
+                          GameScene* ioGameScene);
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__GENOME_CONTROLLER__HPP
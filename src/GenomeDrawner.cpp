@@ -16,97 +16,166 @@
 
 */
 #include "GenomeDrawner.hpp"
+#include <algorithm>
 #include <cassert>
-#include <vector>
-#include "Config.hpp"
+#include <cmath>
 
 namespace aimaze2 {
 
-void GenomeDrawner::updateWithGenome(const Genome& iGenome) {
-  updateNodeSprites(iGenome);
-  updateConnectionSprites(iGenome);
-}
+GenomeDrawner::Diagram GenomeDrawner::CreateDiagram(const Genome& iGenome) {
+  const int numLayers = iGenome.getNumLayers();
 
-void GenomeDrawner::draw(sf::RenderWindow* oRender) const {
-  sf::View view(
-      sf::FloatRect{0.f, 0.f, Config::kWindowWidth, Config::kWindowHeight});
-  view.setViewport(sf::FloatRect{0.5f, 0.03f, 1.f, 1.f});
-  oRender->setView(view);
+  Diagram diagram;
+  diagram._numLayers = static_cast<std::size_t>(numLayers);
+  for (const auto* nodes : {&iGenome.getIONodes(), &iGenome.getHiddenNodes()}) {
+    for (const auto& node : *nodes) {
+      diagram._nodes.push_back(
+          Diagram::Node{node.getNodeID(), ComputeLayerIndex(node, numLayers)});
+    }
+  }
+  for (const auto& connection : iGenome.getConnections()) {
+    diagram._links.push_back(Diagram::Link{connection.getNodeFromID(),
+                                           connection.getNodeToID(),
+                                           connection.getWeight(),
+                                           connection.isEnabled()});
+  }
 
-  drawConnections(oRender);
-  drawNodes(oRender);
+  return diagram;
+}
 
-  oRender->setView(oRender->getDefaultView());
+void GenomeDrawner::updateWithGenome(const Genome& iGenome) {
+  updateWithDiagram(CreateDiagram(iGenome));
 }
 
-void GenomeDrawner::updateNodeSprites(const Genome& iGenome) {
-  static constexpr float kWidthFrame = Config::kWindowWidth / 2.5;
-  static constexpr float kHeightFrame = Config::kWindowWidth / 5;
-  const auto numLayers = iGenome.getNumLayers();
+void GenomeDrawner::updateWithDiagram(const Diagram& iDiagram) {
+  updateNodePositions(iDiagram);
+  updateConnectionLines(iDiagram);
+  updateNodeTriangles(iDiagram);
+  renderToTexture();
+}
 
-  std::vector<std::vector<NodeID>> nodesPerLayer(numLayers);
-  for (const auto& node : iGenome.getIONodes()) {
-    auto layer = node.getLayerID();
-    if (layer == Genome::kIDLayerOutpus) {
-      layer = numLayers - 1;
-    }
-    const auto nodeID = node.getNodeID();
+void GenomeDrawner::draw(sf::RenderTarget* oRender) const {
+  if (_textureCreated) {
+    oRender->draw(_sprite);
+  }
+}
 
-    assert(layer < static_cast<int>(nodesPerLayer.size()));
-    nodesPerLayer[layer].push_back(nodeID);
+void GenomeDrawner::updateNodePositions(const Diagram& iDiagram) {
+  if (iDiagram._numLayers == 0) {
+    _nodePositions.clear();
+    return;
   }
-  for (const auto& node : iGenome.getHiddenNodes()) {
-    auto layer = node.getLayerID();
-    const auto nodeID = node.getNodeID();
-    assert(layer < static_cast<int>(nodesPerLayer.size()));
-    nodesPerLayer[layer].push_back(nodeID);
+
+  NodeID maxNodeID = 0;
+  _numNodesPerLayer.assign(iDiagram._numLayers, 0);
+  for (const auto& node : iDiagram._nodes) {
+    assert(node._layer < _numNodesPerLayer.size());
+    ++_numNodesPerLayer[node._layer];
+    maxNodeID = std::max(maxNodeID, node._nodeID);
   }
 
-  const float kLayerOffset = kWidthFrame / numLayers;
+  const float layerOffset = kWidthFrame / iDiagram._numLayers;
 
-  _nodeSprites.clear();
-  for (std::size_t layer = 0; layer < nodesPerLayer.size(); ++layer) {
-    const auto numNodesOnLayer = nodesPerLayer[layer].size();
-    const float kNodeOffset = kHeightFrame / numNodesOnLayer;
+  _nodePositions.assign(static_cast<std::size_t>(maxNodeID) + 1,
+                        sf::Vector2f{});
+  _numNodesPlaced.assign(iDiagram._numLayers, 0);
+  for (const auto& node : iDiagram._nodes) {
+    const float nodeOffset = kHeightFrame / _numNodesPerLayer[node._layer];
+    const std::size_t n = _numNodesPlaced[node._layer]++;
 
-    for (std::size_t n = 0; n < numNodesOnLayer; ++n) {
-      const NodeID nodeID = nodesPerLayer[layer][n];
-      auto& sprite = _nodeSprites.emplace(nodeID, kRadiusNode).first->second;
-      sprite.setFillColor(Config::kFillColor);
-      sprite.setPosition({layer * kLayerOffset, n * kNodeOffset});
-    }
+    // Position of the center, the frame has a margin of one radius.
+    _nodePositions[node._nodeID] = sf::Vector2f{
+        node._layer * layerOffset + kRadiusNode, n * nodeOffset + kRadiusNode};
   }
 }
 
-void GenomeDrawner::updateConnectionSprites(const Genome& iGenome) {
-  _connectionSprites.clear();
-  for (const auto& connection : iGenome.getConnections()) {
-    const auto nodeFromID = connection.getNodeFromID();
-    const auto nodeToID = connection.getNodeToID();
+void GenomeDrawner::updateConnectionLines(const Diagram& iDiagram) {
+  float maxAbsWeight = 0.f;
+  for (const auto& link : iDiagram._links) {
+    maxAbsWeight = std::max(maxAbsWeight, std::abs(link._weight));
+  }
 
-    const auto& spriteFrom = _nodeSprites.at(nodeFromID);
-    const auto& spriteTo = _nodeSprites.at(nodeToID);
+  _connectionLines.clear();
+  for (const auto& link : iDiagram._links) {
+    const auto nodeFromID = static_cast<std::size_t>(link._nodeFromID);
+    const auto nodeToID = static_cast<std::size_t>(link._nodeToID);
+    if (nodeFromID >= _nodePositions.size() ||
+        nodeToID >= _nodePositions.size()) {
+      continue;
+    }
 
-    LineShape line{spriteFrom.getPosition(), spriteTo.getPosition()};
-    line[0].color = Config::kFillColor;
-    line[0].position += sf::Vector2f{kRadiusNode, kRadiusNode};
-    line[1].color = Config::kFillColor;
-    line[1].position += sf::Vector2f{kRadiusNode, kRadiusNode};
+    sf::Color color = ComputeWeightColor(link._weight, maxAbsWeight);
+    if (link._enabled == false) {
+      color.a /= 4;
+    }
 
-    _connectionSprites.push_back(line);
+    _connectionLines.append(sf::Vertex{_nodePositions[nodeFromID], color});
+    _connectionLines.append(sf::Vertex{_nodePositions[nodeToID], color});
   }
 }
 
-void GenomeDrawner::drawConnections(sf::RenderWindow* oRender) const {
-  for (const auto& connection : _connectionSprites) {
-    oRender->draw(connection.data(), connection.size(), sf::Lines);
+void GenomeDrawner::updateNodeTriangles(const Diagram& iDiagram) {
+  static constexpr float kPi = 3.14159265f;
+  static constexpr float kStepAngle = 2.f * kPi / kNumSegmentsNode;
+
+  _nodeTriangles.clear();
+  for (const auto& node : iDiagram._nodes) {
+    const sf::Vector2f center = _nodePositions[node._nodeID];
+    for (std::size_t s = 0; s < kNumSegmentsNode; ++s) {
+      const float angle0 = kStepAngle * s;
+      const float angle1 = kStepAngle * (s + 1);
+      _nodeTriangles.append(sf::Vertex{center, Config::kFillColor});
+      _nodeTriangles.append(sf::Vertex{
+          center + sf::Vector2f{std::cos(angle0), std::sin(angle0)} *
+                       kRadiusNode,
+          Config::kFillColor});
+      _nodeTriangles.append(sf::Vertex{
+          center + sf::Vector2f{std::cos(angle1), std::sin(angle1)} *
+                       kRadiusNode,
+          Config::kFillColor});
+    }
   }
 }
 
-void GenomeDrawner::drawNodes(sf::RenderWindow* oRender) const {
-  for (const auto& node : _nodeSprites) {
-    oRender->draw(node.second);
+void GenomeDrawner::renderToTexture() {
+  if (_textureCreated == false) {
+    _textureCreated = _renderTexture.create(
+        static_cast<unsigned int>(std::ceil(kWidthFrame + 2.f * kRadiusNode)),
+        static_cast<unsigned int>(std::ceil(kHeightFrame + 2.f * kRadiusNode)));
+    if (_textureCreated == false) {
+      return;
+    }
+    _sprite.setTexture(_renderTexture.getTexture(), true);
+    _sprite.setPosition(kPositionFrame);
   }
+
+  _renderTexture.clear(sf::Color::Transparent);
+  _renderTexture.draw(_connectionLines);
+  _renderTexture.draw(_nodeTriangles);
+  _renderTexture.display();
+}
+
+std::size_t GenomeDrawner::ComputeLayerIndex(const GeneNode& iNode,
+                                             const int iNumLayers) noexcept {
+  const LayerID layer = iNode.getLayerID();
+  if (layer == Genome::kIDLayerOutpus) {
+    return static_cast<std::size_t>(iNumLayers - 1);
+  }
+  return static_cast<std::size_t>(layer);
+}
+
+sf::Color GenomeDrawner::ComputeWeightColor(
+    const float iWeight,
+    const float iMaxAbsWeight) noexcept {
+  static constexpr float kMinAlpha = 32.f;
+  static const sf::Color kColorPositive{0, 90, 200};
+  static const sf::Color kColorNegative{200, 40, 40};
+
+  const float ratio = iMaxAbsWeight > 0.f ? std::abs(iWeight) / iMaxAbsWeight
+                                          : 1.f;
+  sf::Color color = iWeight >= 0.f ? kColorPositive : kColorNegative;
+  color.a = static_cast<sf::Uint8>(kMinAlpha + (255.f - kMinAlpha) * ratio);
+  return color;
 }
 
 }  // namespace aimaze2
@@ -18,31 +18,72 @@
 #ifndef AIMAZE2__GENOME_DRAWNER__HPP
 #define AIMAZE2__GENOME_DRAWNER__HPP
 #include <SFML/Graphics.hpp>
-#include <array>
-#include <map>
 #include <vector>
+#include "Config.hpp"
 #include "Genome.hpp"
 
 namespace aimaze2 {
 
+/*! \brief Draws the diagram of a network.
+ *  \note The diagram is rendered into a texture on `updateWithGenome`, thus
+ *        drawing it costs a single sprite whatever the size of the genome.
+ *        A graphic context must be active on update.
+ */
 class GenomeDrawner {
  public:
+  using NodeID = Genome::NodeID;
+
+  /*! \brief What is drawn of a genome, in plain data. */
+  struct Diagram {
+    struct Node {
+      NodeID _nodeID;
+      std::size_t _layer;
+    };
+    struct Link {
+      NodeID _nodeFromID;
+      NodeID _nodeToID;
+      float _weight;
+      bool _enabled;
+    };
+
+    std::size_t _numLayers = 0;
+    std::vector<Node> _nodes;
+    std::vector<Link> _links;
+  };
+
+  static Diagram CreateDiagram(const Genome& iGenome);
+
   void updateWithGenome(const Genome& iGenome);
-  void draw(sf::RenderWindow* oRender) const;
+  void updateWithDiagram(const Diagram& iDiagram);
+  void draw(sf::RenderTarget* oRender) const;
 
  private:
   static constexpr float kRadiusNode = 5.f;
-  using NodeID = Genome::NodeID;
+  static constexpr std::size_t kNumSegmentsNode = 12;
+  static constexpr float kWidthFrame = Config::kWindowWidth / 2.5f;
+  static constexpr float kHeightFrame = Config::kWindowWidth / 5.f;
+  static inline const sf::Vector2f kPositionFrame{
+      Config::kWindowWidth * 0.5f, Config::kWindowHeight * 0.03f};
   using LayerID = Genome::LayerID;
-  using LineShape = std::array<sf::Vertex, 2>;
 
-  std::map<NodeID, sf::CircleShape> _nodeSprites;
-  std::vector<LineShape> _connectionSprites;
+  bool _textureCreated = false;
+  sf::RenderTexture _renderTexture;
+  sf::Sprite _sprite;
+  std::vector<sf::Vector2f> _nodePositions;
+  std::vector<std::size_t> _numNodesPerLayer;
+  std::vector<std::size_t> _numNodesPlaced;
+  sf::VertexArray _connectionLines{sf::Lines};
+  sf::VertexArray _nodeTriangles{sf::Triangles};
+
+  void updateNodePositions(const Diagram& iDiagram);
+  void updateConnectionLines(const Diagram& iDiagram);
+  void updateNodeTriangles(const Diagram& iDiagram);
+  void renderToTexture();
 
-  void updateNodeSprites(const Genome& iGenome);
-  void updateConnectionSprites(const Genome& iGenome);
-  void drawConnections(sf::RenderWindow* oRender) const;
-  void drawNodes(sf::RenderWindow* oRender) const;
+  static std::size_t ComputeLayerIndex(const GeneNode& iNode,
+                                       const int iNumLayers) noexcept;
+  static sf::Color ComputeWeightColor(const float iWeight,
+                                      const float iMaxAbsWeight) noexcept;
 };
 
 }  // namespace aimaze2
@@ -79,13 +79,44 @@ void Ground::update(const float iGameVelocity, Config::RndEngine* iRndEngine) {
   }
 }
 
-void Ground::draw(sf::RenderWindow* oRender) const {
-  oRender->draw(_lineSprite);
+void Ground::advance(const float iGameVelocity, const int iNumTicks) {
+  const float kDeltaMovement = iGameVelocity * Config::kDeltaTimeLogicUpdate;
+
+  for (auto& rockSprite : _rockSprites) {
+    auto position = rockSprite.getPosition();
+    for (int i = 0; i < iNumTicks; ++i) {
+      position.x -= kDeltaMovement;
+    }
+    rockSprite.setPosition(position);
+  }
+}
+
+void Ground::draw(SpriteBatch* oBatch) const {
+  oBatch->addRect(_lineSprite.getGlobalBounds(), Config::kFillColor);
   for (const auto& rockSprite : _rockSprites) {
-    oRender->draw(rockSprite);
+    oBatch->addRect(rockSprite.getGlobalBounds(), Config::kFillColor);
   }
 }
 
+int Ground::computeTicksToRegenerate(const float iGameVelocity,
+                                     const int iMaxTicks) const noexcept {
+  const float kDeltaMovement = iGameVelocity * Config::kDeltaTimeLogicUpdate;
+
+  int numTicks = iMaxTicks;
+  for (const auto& rockSprite : _rockSprites) {
+    float right = rockSprite.getPosition().x + rockSprite.getSize().x;
+    for (int i = 0; i < numTicks; ++i) {
+      right -= kDeltaMovement;
+      if (right <= kDeltaMovement) {
+        numTicks = i;
+        break;
+      }
+    }
+  }
+
+  return numTicks;
+}
+
 void Ground::distributeRocksPosition(Config::RndEngine* iRndEngine) {
   constexpr float kGapPosition = static_cast<float>(Config::kWindowWidth) /
                                  static_cast<float>(kNumOfRocks);
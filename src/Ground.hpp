@@ -20,6 +20,7 @@
 #include <SFML/Graphics.hpp>
 #include <array>
 #include "Config.hpp"
+#include "SpriteBatch.hpp"
 
 namespace aimaze2 {
 
@@ -32,7 +33,20 @@ class Ground {
 
   void update(const float iGameVelocity, Config::RndEngine* iRndEngine);
 
-  void draw(sf::RenderWindow* oRender) const;
+  /*! \note Preconditions: no rock gets regenerated within those ticks.
+   *  \see computeTicksToRegenerate
+   */
+  void advance(const float iGameVelocity, const int iNumTicks);
+
+  void draw(SpriteBatch* oBatch) const;
+
+  /*! \brief Number of ticks (at most iMaxTicks) the ground can be advanced
+   *         without any rock leaving the screen.
+   *  \note It is conservative by one tick as the rock is regenerated (and
+   *        the random engine consumed) in `update` only.
+   */
+  int computeTicksToRegenerate(const float iGameVelocity,
+                               const int iMaxTicks) const noexcept;
 
  private:
   void distributeRocksPosition(Config::RndEngine* iRndEngine);
@@ -0,0 +1,36 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__HASH_COMBINE__HPP
+#define AIMAZE2__HASH_COMBINE__HPP
+#include <cstddef>
+#include <functional>
+
+namespace aimaze2 {
+
+/*! \brief Mixes the hash of iValue into ioSeed (as boost::hash_combine).
+ *  \note The result depends on the order of the calls.
+ */
+template <typename T>
+void HashCombine(std::size_t* ioSeed, const T& iValue) {
+  *ioSeed ^=
+      std::hash<T>{}(iValue) + 0x9e3779b9 + (*ioSeed << 6) + (*ioSeed >> 2);
+}
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__HASH_COMBINE__HPP
@@ -17,62 +17,88 @@
 */
 #include "InfoDrawner.hpp"
 #include <cassert>
+#include <limits>
+#include <string>
+#include "Assets.hpp"
 #include "Config.hpp"
 
 namespace aimaze2 {
 
-void InfoDrawner::init() { _font.loadFromFile("data/Font.ttf"); }
+void InfoDrawner::init() {
+  Assets::LoadFont("Font.ttf", &_font);
+  _textInfos.clear();
+  _genomeInputs.clear();
+}
 
-void InfoDrawner::update(const Population& iPopulation,
-                         const int iNumAlive,
-                         const Genome& iGenome,
+void InfoDrawner::update(const std::size_t iPopulationSize,
+                         const std::size_t iNumAlive,
+                         const std::vector<float>& iGenomeInputs,
                          const int iGenerationNum) {
-  _textInfos.clear();
-  updateTextStrPopulationSize(iPopulation);
-  updateTextStrNumAlive(iNumAlive);
-  updateTextStrGenerationNum(iGenerationNum);
-  updateTextGenome(iGenome);
-  updateTextPositions();
+  const bool resized = _textInfos.size() != FIRST_INPUT + iGenomeInputs.size();
+  if (resized) {
+    resizeTexts(iGenomeInputs.size());
+  }
+
+  if (resized || iPopulationSize != _populationSize) {
+    updateTextStrPopulationSize(iPopulationSize);
+  }
+  if (resized || iNumAlive != _numAlive) {
+    updateTextStrNumAlive(iNumAlive);
+  }
+  if (resized || iGenerationNum != _generationNum) {
+    updateTextStrGenerationNum(iGenerationNum);
+  }
+  if (iGenomeInputs != _genomeInputs) {
+    updateTextGenome(iGenomeInputs);
+  }
 }
 
-void InfoDrawner::draw(sf::RenderWindow* oRender) const {
+void InfoDrawner::draw(sf::RenderTarget* oRender) const {
   for (const auto& textInfo : _textInfos) {
     oRender->draw(textInfo);
   }
 }
 
-void InfoDrawner::updateTextStrPopulationSize(const Population& iPopulation) {
-  _textInfos.emplace_back(
-      "Population Size: " + std::to_string(iPopulation.getPopulationSize()),
-      _font,
-      kSizeText);
-  _textInfos.back().setFillColor(Config::kFillColor);
+void InfoDrawner::resizeTexts(const std::size_t iNumInputs) {
+  _textInfos.resize(FIRST_INPUT + iNumInputs);
+  for (auto& textInfo : _textInfos) {
+    textInfo.setFont(_font);
+    textInfo.setCharacterSize(kSizeText);
+    textInfo.setFillColor(Config::kFillColor);
+  }
+  // NaN differs from any value: all the inputs are going to be formatted.
+  _genomeInputs.assign(iNumInputs, std::numeric_limits<float>::quiet_NaN());
+  updateTextPositions();
+}
+
+void InfoDrawner::updateTextStrPopulationSize(
+    const std::size_t iPopulationSize) {
+  _populationSize = iPopulationSize;
+  _textInfos[POPULATION_SIZE].setString("Population Size: " +
+                                        std::to_string(iPopulationSize));
 }
 
-void InfoDrawner::updateTextStrNumAlive(const int iNumAlive) {
-  _textInfos.emplace_back(
-      "No. Alive: " + std::to_string(iNumAlive), _font, kSizeText);
-  _textInfos.back().setFillColor(Config::kFillColor);
+void InfoDrawner::updateTextStrNumAlive(const std::size_t iNumAlive) {
+  _numAlive = iNumAlive;
+  _textInfos[NUM_ALIVE].setString("No. Alive: " + std::to_string(iNumAlive));
 }
 
 void InfoDrawner::updateTextStrGenerationNum(const int iGenerationNum) {
-  _textInfos.emplace_back(
-      "No. Generation: " + std::to_string(iGenerationNum), _font, kSizeText);
-  _textInfos.back().setFillColor(Config::kFillColor);
+  _generationNum = iGenerationNum;
+  _textInfos[GENERATION_NUM].setString("No. Generation: " +
+                                       std::to_string(iGenerationNum));
 }
 
-void InfoDrawner::updateTextGenome(const Genome& iGenome) {
-  const std::size_t kNumInputs = iGenome.getNumInputs();
-  const auto& ioNodes = iGenome.getIONodes();
-
-  for (std::size_t i = 0; i < kNumInputs; ++i) {
-    assert(i < ioNodes.size());
-    const float value = ioNodes[i].getValueWithActivation();
-    _textInfos.emplace_back(
-        "Input " + std::to_string(i) + ": " + std::to_string(value),
-        _font,
-        kSizeText);
-    _textInfos.back().setFillColor(Config::kFillColor);
+void InfoDrawner::updateTextGenome(const std::vector<float>& iGenomeInputs) {
+  assert(_genomeInputs.size() == iGenomeInputs.size());
+  for (std::size_t i = 0; i < iGenomeInputs.size(); ++i) {
+    const float value = iGenomeInputs[i];
+    if (value == _genomeInputs[i]) {
+      continue;
+    }
+    _genomeInputs[i] = value;
+    _textInfos[FIRST_INPUT + i].setString("Input " + std::to_string(i) + ": " +
+                                          std::to_string(value));
   }
 }
 
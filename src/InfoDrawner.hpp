@@ -19,31 +19,45 @@
 #define AIMAZE2__INFO_DRAWNER__HPP
 #include <SFML/Graphics.hpp>
 #include <vector>
-#include "Genome.hpp"
-#include "Population.hpp"
 
 namespace aimaze2 {
 
+/*! \brief Panel with the numbers of the current generation.
+ *  \note The texts are preallocated and formatted only when their value
+ *        changes.
+ */
 class InfoDrawner {
  public:
   static constexpr unsigned int kSizeText = 9;
   static constexpr float kSpacingLine = 10.f;
 
   void init();
-  void update(const Population& iPopulation,
-              const int iNumAlive,
-              const Genome& iGenome,
+  void update(const std::size_t iPopulationSize,
+              const std::size_t iNumAlive,
+              const std::vector<float>& iGenomeInputs,
               const int iGenerationNum);
-  void draw(sf::RenderWindow* oRender) const;
+  void draw(sf::RenderTarget* oRender) const;
 
  private:
+  enum TextID : std::size_t {
+    POPULATION_SIZE,
+    NUM_ALIVE,
+    GENERATION_NUM,
+    FIRST_INPUT
+  };
+
   sf::Font _font;
   std::vector<sf::Text> _textInfos;
+  std::size_t _populationSize;
+  std::size_t _numAlive;
+  int _generationNum;
+  std::vector<float> _genomeInputs;
 
-  void updateTextStrPopulationSize(const Population& iPopulation);
-  void updateTextStrNumAlive(const int iNumAlive);
+  void resizeTexts(const std::size_t iNumInputs);
+  void updateTextStrPopulationSize(const std::size_t iPopulationSize);
+  void updateTextStrNumAlive(const std::size_t iNumAlive);
   void updateTextStrGenerationNum(const int iGenerationNum);
-  void updateTextGenome(const Genome& iGenome);
+  void updateTextGenome(const std::vector<float>& iGenomeInputs);
   void updateTextPositions();
 };
 
@@ -52,6 +52,10 @@ InnovationHistory::getNextInnovationNumAndIncrement() noexcept {
 
 void InnovationHistory::flush() noexcept { return _connectionsHistory.clear(); }
 
+std::size_t InnovationHistory::computeDynamicMemoryUsage() const noexcept {
+  return _connectionsHistory.capacity() * sizeof(ConnectionHistory);
+}
+
 InnovationHistory::ConnectionHistory::ConnectionHistory(
     const NodeID iNodeFrom,
     const NodeID iNodeTo,
@@ -41,6 +41,9 @@ class InnovationHistory {
 
   void flush() noexcept;
 
+  /*! \note sizeof(InnovationHistory) is not included. */
+  std::size_t computeDynamicMemoryUsage() const noexcept;
+
  private:
   struct ConnectionHistory {
     NodeID _nodeFrom;
@@ -0,0 +1,72 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "LoopStats.hpp"
+
+namespace aimaze2 {
+
+void LoopStats::reset() {
+  _clock.restart();
+  _numTicks = 0;
+  _numFrames = 0;
+  _sumFrameTimeUs = 0;
+  _maxFrameTimeUs = 0;
+}
+
+void LoopStats::addTicks(const std::size_t iNumTicks) noexcept {
+  _numTicks += iNumTicks;
+}
+
+void LoopStats::addFrame(const sf::Time iFrameTime) noexcept {
+  const auto frameTimeUs =
+      static_cast<std::uint64_t>(iFrameTime.asMicroseconds());
+
+  _numFrames.fetch_add(1, std::memory_order_relaxed);
+  _sumFrameTimeUs.fetch_add(frameTimeUs, std::memory_order_relaxed);
+
+  std::uint64_t maxFrameTimeUs =
+      _maxFrameTimeUs.load(std::memory_order_relaxed);
+  while (frameTimeUs > maxFrameTimeUs &&
+         !_maxFrameTimeUs.compare_exchange_weak(
+             maxFrameTimeUs, frameTimeUs, std::memory_order_relaxed)) {
+  }
+}
+
+float LoopStats::computeTickRate() const {
+  const float elapsed = _clock.getElapsedTime().asSeconds();
+  return elapsed > 0.f ? static_cast<float>(_numTicks) / elapsed : 0.f;
+}
+
+std::uint64_t LoopStats::getNumFrames() const noexcept {
+  return _numFrames.load(std::memory_order_relaxed);
+}
+
+float LoopStats::computeMeanFrameTime() const noexcept {
+  const std::uint64_t numFrames = getNumFrames();
+  if (numFrames == 0) {
+    return 0.f;
+  }
+  return static_cast<float>(_sumFrameTimeUs.load(std::memory_order_relaxed)) /
+         static_cast<float>(numFrames) / 1000.f;
+}
+
+float LoopStats::getMaxFrameTime() const noexcept {
+  return static_cast<float>(_maxFrameTimeUs.load(std::memory_order_relaxed)) /
+         1000.f;
+}
+
+}  // namespace aimaze2
@@ -0,0 +1,55 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__LOOP_STATS__HPP
+#define AIMAZE2__LOOP_STATS__HPP
+#include <SFML/System.hpp>
+#include <atomic>
+#include <cstdint>
+
+namespace aimaze2 {
+
+/*! \brief Throughput of the logic and frame times of the render.
+ *  \note Ticks are added by the logic thread, frames by the render thread.
+ */
+class LoopStats {
+ public:
+  void reset();
+
+  void addTicks(const std::size_t iNumTicks) noexcept;
+  void addFrame(const sf::Time iFrameTime) noexcept;
+
+  /*! \brief Logic ticks per second of wall time since `reset`. */
+  float computeTickRate() const;
+
+  std::uint64_t getNumFrames() const noexcept;
+
+  /*! \brief Frame times in milliseconds. */
+  float computeMeanFrameTime() const noexcept;
+  float getMaxFrameTime() const noexcept;
+
+ private:
+  sf::Clock _clock;
+  std::size_t _numTicks = 0;
+  std::atomic<std::uint64_t> _numFrames = 0;
+  std::atomic<std::uint64_t> _sumFrameTimeUs = 0;
+  std::atomic<std::uint64_t> _maxFrameTimeUs = 0;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__LOOP_STATS__HPP
@@ -0,0 +1,41 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__MEMORY_REPORT__HPP
+#define AIMAZE2__MEMORY_REPORT__HPP
+#include <cstddef>
+#include <cstdint>
+
+namespace aimaze2 {
+
+/*! \brief Live bytes of the main containers and allocations of a
+ *         generation.
+ *  \note Allocations are counted only with AllocationCounter::kEnabled.
+ */
+struct MemoryReport {
+  std::size_t _genomes = 0;
+  std::size_t _species = 0;
+  std::size_t _innovationHistory = 0;
+  std::size_t _players = 0;
+  std::size_t _obstacles = 0;
+  std::uint64_t _numAllocations = 0;
+  std::uint64_t _numAllocatedBytes = 0;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__MEMORY_REPORT__HPP
@@ -0,0 +1,264 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "MetricsServer.hpp"
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+namespace {
+
+constexpr int kPollPeriodMs = 100;
+constexpr int kRequestTimeoutMs = 50;
+constexpr auto kTicksRatePeriod = std::chrono::seconds{1};
+
+// Where MSG_NOSIGNAL is missing (macOS), SO_NOSIGPIPE is set on the socket.
+#ifdef MSG_NOSIGNAL
+constexpr int kSendFlags = MSG_NOSIGNAL;
+#else
+constexpr int kSendFlags = 0;
+#endif
+
+bool SetCloseOnExec(const int iFd) {
+  const int flags = ::fcntl(iFd, F_GETFD);
+  return flags != -1 && ::fcntl(iFd, F_SETFD, flags | FD_CLOEXEC) != -1;
+}
+
+bool SetNoSigPipe([[maybe_unused]] const int iFd) {
+#ifdef SO_NOSIGPIPE
+  const int on = 1;
+  return ::setsockopt(iFd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on)) != -1;
+#else
+  return true;
+#endif
+}
+
+/*! \brief Opens a UNIX stream socket, not inherited by child processes.
+ *  \return The socket, -1 on failure.
+ */
+int OpenSocket() {
+  const int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+  if (fd != -1 && (!::SetCloseOnExec(fd) || !::SetNoSigPipe(fd))) {
+    ::close(fd);
+    return -1;
+  }
+  return fd;
+}
+
+/*! \brief Whether the path is a socket left behind by a dead server.
+ *  \note Any other file, or a socket still accepting, must not be removed.
+ */
+bool IsStaleSocket(const sockaddr_un& iAddress) {
+  struct stat status;
+  if (::lstat(iAddress.sun_path, &status) == -1 || !S_ISSOCK(status.st_mode)) {
+    return false;
+  }
+
+  const int probe = ::OpenSocket();
+  if (probe == -1) {
+    return false;
+  }
+  const bool refused = ::connect(probe,
+                                 reinterpret_cast<const sockaddr*>(&iAddress),
+                                 sizeof(iAddress)) == -1 &&
+                       errno == ECONNREFUSED;
+  ::close(probe);
+  return refused;
+}
+
+bool SendAll(const int iClient, const std::string& iText) {
+  std::size_t sent = 0;
+  while (sent < iText.size()) {
+    const ssize_t n = ::send(
+        iClient, iText.data() + sent, iText.size() - sent, ::kSendFlags);
+    if (n <= 0) {
+      return false;
+    }
+    sent += static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+}  // anonymous namespace
+
+namespace aimaze2 {
+
+MetricsServer::~MetricsServer() { close(); }
+
+bool MetricsServer::open(const std::string& iPath) {
+  close();
+
+  sockaddr_un address;
+  std::memset(&address, 0, sizeof(address));
+  address.sun_family = AF_UNIX;
+  if (iPath.empty() || iPath.size() >= sizeof(address.sun_path)) {
+    return false;
+  }
+  std::memcpy(address.sun_path, iPath.c_str(), iPath.size());
+
+  _socket = ::OpenSocket();
+  if (_socket == -1) {
+    return false;
+  }
+
+  if (::IsStaleSocket(address)) {
+    ::unlink(iPath.c_str());
+  }
+  if (::bind(_socket,
+             reinterpret_cast<const sockaddr*>(&address),
+             sizeof(address)) == -1 ||
+      ::listen(_socket, SOMAXCONN) == -1) {
+    ::close(_socket);
+    _socket = -1;
+    return false;
+  }
+
+  _path = iPath;
+  _stopping = false;
+  _thread = std::thread{&MetricsServer::serveLoop, this};
+  return true;
+}
+
+void MetricsServer::close() {
+  if (_socket == -1) {
+    return;
+  }
+
+  _stopping = true;
+  _thread.join();
+
+  ::close(_socket);
+  _socket = -1;
+  ::unlink(_path.c_str());
+}
+
+void MetricsServer::setGeneration(const int iGenerationNum) noexcept {
+  _generationNum.store(iGenerationNum, std::memory_order_relaxed);
+}
+
+void MetricsServer::addTicks(const std::size_t iNumTicks) noexcept {
+  // Only the logic thread writes: no read-modify-write needed.
+  _numTicks.store(_numTicks.load(std::memory_order_relaxed) + iNumTicks,
+                  std::memory_order_relaxed);
+}
+
+void MetricsServer::setNumPlayersAlive(
+    const std::size_t iNumPlayersAlive) noexcept {
+  _numPlayersAlive.store(iNumPlayersAlive, std::memory_order_relaxed);
+}
+
+void MetricsServer::setGenerationResults(
+    const float iFitnessBest,
+    const std::size_t iNumSpecies,
+    const std::array<double, Profiler::kNumPhases>& iPhaseTimes) noexcept {
+  _fitnessBest.store(iFitnessBest, std::memory_order_relaxed);
+  _numSpecies.store(iNumSpecies, std::memory_order_relaxed);
+  for (std::size_t i = 0; i < Profiler::kNumPhases; ++i) {
+    _phaseTimes[i].store(iPhaseTimes[i], std::memory_order_relaxed);
+  }
+}
+
+void MetricsServer::serveLoop() {
+  using Clock = std::chrono::steady_clock;
+
+  Clock::time_point sampleTime = Clock::now();
+  std::uint64_t sampleTicks = _numTicks.load(std::memory_order_relaxed);
+
+  while (!_stopping) {
+    pollfd pollSocket{_socket, POLLIN, 0};
+    const int ready = ::poll(&pollSocket, 1, ::kPollPeriodMs);
+
+    const Clock::time_point now = Clock::now();
+    if (now - sampleTime >= ::kTicksRatePeriod) {
+      const std::uint64_t ticks = _numTicks.load(std::memory_order_relaxed);
+      _ticksPerSecond =
+          static_cast<double>(ticks - sampleTicks) /
+          std::chrono::duration<double>(now - sampleTime).count();
+      sampleTime = now;
+      sampleTicks = ticks;
+    }
+
+    if (ready > 0) {
+      const int client = ::accept(_socket, nullptr, nullptr);
+      if (client != -1) {
+        if (::SetCloseOnExec(client) && ::SetNoSigPipe(client)) {
+          serveClient(client);
+        }
+        ::close(client);
+      }
+    }
+  }
+}
+
+void MetricsServer::serveClient(const int iClient) const {
+  // The request is optional: a client which sends nothing gets the text.
+  char request[16] = {};
+  pollfd pollClient{iClient, POLLIN, 0};
+  if (::poll(&pollClient, 1, ::kRequestTimeoutMs) > 0) {
+    ::recv(iClient, request, sizeof(request) - 1, 0);
+  }
+
+  const bool json = std::strncmp(request, "json", 4) == 0;
+  ::SendAll(iClient, json ? formatJson() : formatText());
+}
+
+std::string MetricsServer::formatText() const {
+  std::ostringstream text;
+  text << "aimaze2_generation "
+       << _generationNum.load(std::memory_order_relaxed) << '\n'
+       << "aimaze2_ticks_per_second " << _ticksPerSecond << '\n'
+       << "aimaze2_players_alive "
+       << _numPlayersAlive.load(std::memory_order_relaxed) << '\n'
+       << "aimaze2_fitness_best "
+       << _fitnessBest.load(std::memory_order_relaxed) << '\n'
+       << "aimaze2_species " << _numSpecies.load(std::memory_order_relaxed)
+       << '\n';
+  for (std::size_t i = 0; i < Profiler::kNumPhases; ++i) {
+    text << "aimaze2_phase_milliseconds{phase=\""
+         << Profiler::GetPhaseName(static_cast<Profiler::Phase>(i)) << "\"} "
+         << _phaseTimes[i].load(std::memory_order_relaxed) << '\n';
+  }
+  return text.str();
+}
+
+std::string MetricsServer::formatJson() const {
+  std::ostringstream json;
+  json << "{\"generation\":"
+       << _generationNum.load(std::memory_order_relaxed)
+       << ",\"ticks_per_second\":" << _ticksPerSecond
+       << ",\"players_alive\":"
+       << _numPlayersAlive.load(std::memory_order_relaxed)
+       << ",\"fitness_best\":" << _fitnessBest.load(std::memory_order_relaxed)
+       << ",\"species\":" << _numSpecies.load(std::memory_order_relaxed)
+       << ",\"phase_milliseconds\":{";
+  for (std::size_t i = 0; i < Profiler::kNumPhases; ++i) {
+    json << (i == 0 ? "\"" : ",\"")
+         << Profiler::GetPhaseName(static_cast<Profiler::Phase>(i))
+         << "\":" << _phaseTimes[i].load(std::memory_order_relaxed);
+  }
+  json << "}}\n";
+  return json.str();
+}
+
+}  // namespace aimaze2
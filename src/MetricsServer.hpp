@@ -0,0 +1,84 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__METRICS_SERVER__HPP
+#define AIMAZE2__METRICS_SERVER__HPP
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include "Profiler.hpp"
+
+namespace aimaze2 {
+
+/*! \brief Serves a snapshot of the training on a UNIX domain socket.
+ *  \note The logic thread only stores into atomics, a background thread
+ *        accepts the clients and formats the snapshot. A client gets the
+ *        Prometheus text format, or JSON if it sends "json" first; then the
+ *        connection is closed.
+ *        Ticks per second are measured by the server, over the last second.
+ */
+class MetricsServer {
+ public:
+  MetricsServer() = default;
+  MetricsServer(const MetricsServer&) = delete;
+  MetricsServer& operator=(const MetricsServer&) = delete;
+  ~MetricsServer();
+
+  /*! \brief Listens on iPath, replacing a socket left by a previous run. */
+  bool open(const std::string& iPath);
+
+  /*! \brief Stops serving and removes the socket. */
+  void close();
+
+  void setGeneration(const int iGenerationNum) noexcept;
+  void addTicks(const std::size_t iNumTicks) noexcept;
+  void setNumPlayersAlive(const std::size_t iNumPlayersAlive) noexcept;
+
+  /*! \param iPhaseTimes Milliseconds spent in each phase by the generation. */
+  void setGenerationResults(
+      const float iFitnessBest,
+      const std::size_t iNumSpecies,
+      const std::array<double, Profiler::kNumPhases>& iPhaseTimes) noexcept;
+
+ private:
+  int _socket = -1;
+  std::string _path;
+  std::thread _thread;
+  std::atomic<bool> _stopping = false;
+
+  std::atomic<int> _generationNum = 0;
+  std::atomic<std::uint64_t> _numTicks = 0;
+  std::atomic<std::size_t> _numPlayersAlive = 0;
+  std::atomic<float> _fitnessBest = 0.f;
+  std::atomic<std::size_t> _numSpecies = 0;
+  std::array<std::atomic<double>, Profiler::kNumPhases> _phaseTimes{};
+
+  // Owned by the server thread.
+  double _ticksPerSecond = 0.0;
+
+  void serveLoop();
+  void serveClient(const int iClient) const;
+  std::string formatText() const;
+  std::string formatJson() const;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__METRICS_SERVER__HPP
@@ -46,39 +46,49 @@ sf::Vector2f GetInitialPosition(
 
 namespace aimaze2 {
 
-void Obstacle::initTextures() {
-  std::get<TextureID::CACTUS_SMALL>(kTextures).loadFromFile(
-      "data/cactusSmall0000.png");
-  std::get<TextureID::CACTUS_BIG>(kTextures).loadFromFile(
-      "data/cactusBig0000.png");
-  std::get<TextureID::CACTUS_LARGE>(kTextures).loadFromFile(
-      "data/cactusSmallMany0000.png");
-  std::get<TextureID::BIRD_0>(kTextures).loadFromFile("data/berd.png");
-  std::get<TextureID::BIRD_1>(kTextures).loadFromFile("data/berd2.png");
-}
-
 void Obstacle::init(const ObstacleType iObstacleType) {
   const auto textureID = GetFirstTexture(iObstacleType);
 
-  assert(textureID < kTextures.size());
-  _sprite.setTexture(kTextures[textureID]);
+  assert(textureID < kFrames.size());
+  _sprite.setTextureRect(SpriteAtlas::GetFrameRect(kFrames[textureID]));
   _sprite.setPosition(::GetInitialPosition(iObstacleType));
+  _previousPosition = _sprite.getPosition();
 
   _textureID = textureID;
+  _accumulatorAnimation = 0.f;
 }
 
 void Obstacle::update(const float iGameVelocity) {
   updateAnimation();
 
   const float kDeltaMovement = iGameVelocity * Config::kDeltaTimeLogicUpdate;
+  _previousPosition = _sprite.getPosition();
   _sprite.move({-kDeltaMovement, 0.f});
 }
 
-void Obstacle::draw(sf::RenderWindow* oRender) const {
-  oRender->draw(_sprite);
+void Obstacle::advance(const float iGameVelocity, const int iNumTicks) {
+  bool changedTexture = false;
+  for (int i = 0; i < iNumTicks; ++i) {
+    changedTexture |= stepAnimation();
+  }
+  if (changedTexture) {
+    _sprite.setTextureRect(SpriteAtlas::GetFrameRect(kFrames[_textureID]));
+  }
+
+  const float kDeltaMovement = iGameVelocity * Config::kDeltaTimeLogicUpdate;
+  auto position = _sprite.getPosition();
+  for (int i = 0; i < iNumTicks; ++i) {
+    _previousPosition = position;
+    position.x -= kDeltaMovement;
+  }
+  _sprite.setPosition(position);
+}
+
+void Obstacle::draw(SpriteBatch* oSprites, SpriteBatch* oDebug) const {
+  oSprites->addSprite(_sprite.getGlobalBounds(), _sprite.getTextureRect());
 
   if constexpr (Config::kDrawCollisionBox) {
-    drawCollisionBox(oRender);
+    drawCollisionBox(oDebug);
   }
 }
 
@@ -97,38 +107,39 @@ sf::FloatRect Obstacle::getCollisionBox() const {
   return box;
 }
 
+sf::Vector2f Obstacle::getLastMotion() const noexcept {
+  return _sprite.getPosition() - _previousPosition;
+}
+
 const sf::Vector2f& Obstacle::getPosition() const noexcept {
   return _sprite.getPosition();
 }
 
-void Obstacle::drawCollisionBox(sf::RenderWindow* oRender) const {
-  static sf::RectangleShape box;
-
-  const auto collisionBox = getCollisionBox();
-  box.setSize(sf::Vector2f{collisionBox.width, collisionBox.height});
-  box.setOutlineColor(Config::kDebugColor);
-  box.setOutlineThickness(2.f);
-  box.setFillColor(sf::Color{0, 0, 0, 0});
-  box.setPosition(sf::Vector2f{collisionBox.left, collisionBox.top});
-
-  oRender->draw(box);
+void Obstacle::drawCollisionBox(SpriteBatch* oDebug) const {
+  oDebug->addOutline(getCollisionBox(), 2.f, Config::kDebugColor);
 }
 
 void Obstacle::updateAnimation() {
+  if (stepAnimation()) {
+    _sprite.setTextureRect(SpriteAtlas::GetFrameRect(kFrames[_textureID]));
+  }
+}
+
+bool Obstacle::stepAnimation() noexcept {
   static constexpr float kTimePerFrame = 0.3f;
-  static float accumulator = 0.f;
 
+  bool changedTexture = false;
   if (_textureID == TextureID::BIRD_0 || _textureID == TextureID::BIRD_1) {
-    if (kTimePerFrame <= accumulator) {
+    if (kTimePerFrame <= _accumulatorAnimation) {
       _textureID = _textureID == TextureID::BIRD_0 ? TextureID::BIRD_1
                                                    : TextureID::BIRD_0;
-      _sprite.setTexture(kTextures[_textureID], true);
-      accumulator -= kTimePerFrame;
+      _accumulatorAnimation -= kTimePerFrame;
+      changedTexture = true;
     }
-    accumulator += Config::kDeltaTimeLogicUpdate;
-  } else {
-    accumulator = 0.f;
+    _accumulatorAnimation += Config::kDeltaTimeLogicUpdate;
   }
+
+  return changedTexture;
 }
 
 Obstacle::TextureID Obstacle::GetFirstTexture(
@@ -20,6 +20,8 @@
 #include <SFML/Graphics.hpp>
 #include <array>
 #include "Config.hpp"
+#include "SpriteAtlas.hpp"
+#include "SpriteBatch.hpp"
 
 namespace aimaze2 {
 
@@ -35,16 +37,18 @@ class Obstacle {
     BIRD_HIGH
   };
 
-  static void initTextures();
-
   void init(const ObstacleType iObstacleType);
   void update(const float iGameVelocity);
-  void draw(sf::RenderWindow* oRender) const;
+  void advance(const float iGameVelocity, const int iNumTicks);
+  void draw(SpriteBatch* oSprites, SpriteBatch* oDebug) const;
 
   bool isOutOfScreenOnLeft() const;
 
   sf::FloatRect getCollisionBox() const;
 
+  /*! \brief Displacement of the obstacle during the last logic tick. */
+  sf::Vector2f getLastMotion() const noexcept;
+
   const sf::Vector2f& getPosition() const noexcept;
 
  private:
@@ -56,13 +60,21 @@ class Obstacle {
     BIRD_1
   };
   static constexpr std::size_t kNumTextures = 5;
-  static inline std::array<sf::Texture, kNumTextures> kTextures;
+  static constexpr std::array<SpriteAtlas::FrameID, kNumTextures> kFrames{
+      SpriteAtlas::CACTUS_SMALL,
+      SpriteAtlas::CACTUS_BIG,
+      SpriteAtlas::CACTUS_LARGE,
+      SpriteAtlas::BIRD_0,
+      SpriteAtlas::BIRD_1};
 
   sf::Sprite _sprite;
+  sf::Vector2f _previousPosition;
   TextureID _textureID;
+  float _accumulatorAnimation;
 
-  void drawCollisionBox(sf::RenderWindow* oRender) const;
+  void drawCollisionBox(SpriteBatch* oDebug) const;
   void updateAnimation();
+  bool stepAnimation() noexcept;
 
   static TextureID GetFirstTexture(const ObstacleType iObstacleType);
 };
@@ -37,8 +37,9 @@ namespace aimaze2 {
 
 void ObstacleManager::init(const SeedType iSeed) {
   _rndEngine.seed(iSeed);
-  Obstacle::initTextures();
+  SpriteAtlas::init();
   _obstacles.clear();
+  _accumulatorSpawn = 0.f;
 }
 
 void ObstacleManager::update(const float iGameVelocity) {
@@ -53,9 +54,26 @@ void ObstacleManager::update(const float iGameVelocity) {
   }
 }
 
-void ObstacleManager::draw(sf::RenderWindow* oRender) const {
+void ObstacleManager::advance(const float iGameVelocity, const int iNumTicks) {
+  assert(iNumTicks <= computeTicksToSpawn(iGameVelocity, iNumTicks));
+
+  for (int i = 0; i < iNumTicks; ++i) {
+    _accumulatorSpawn += Config::kDeltaTimeLogicUpdate;
+  }
+
+  for (auto& obstacle : _obstacles) {
+    obstacle.advance(iGameVelocity, iNumTicks);
+  }
+
+  // Several obstacles may have left the screen during the ticks.
+  while (!_obstacles.empty() && _obstacles.front().isOutOfScreenOnLeft()) {
+    _obstacles.pop_front();
+  }
+}
+
+void ObstacleManager::draw(SpriteBatch* oSprites, SpriteBatch* oDebug) const {
   for (const auto& obstacle : _obstacles) {
-    obstacle.draw(oRender);
+    obstacle.draw(oSprites, oDebug);
   }
 }
 
@@ -63,24 +81,38 @@ const std::deque<Obstacle>& ObstacleManager::getObstacles() const noexcept {
   return _obstacles;
 }
 
-void ObstacleManager::updateSpawn(const float iGameVelocity) {
-  constexpr float kDeltaVariance = 1.0f;
-  constexpr float kSpawnBaseTime = 3.f;
-  constexpr float kScaleVelocity = 0.002f;
+int ObstacleManager::computeTicksToSpawn(const float iGameVelocity,
+                                         const int iMaxTicks) const noexcept {
+  const float timeToSpawn = ComputeTimeToSpawn(iGameVelocity);
+
+  float accumulator = _accumulatorSpawn;
+  for (int i = 0; i < iMaxTicks; ++i) {
+    if (timeToSpawn <= accumulator) {
+      return i;
+    }
+    accumulator += Config::kDeltaTimeLogicUpdate;
+  }
 
-  static float accumulator = 0;
-  static std::uniform_real_distribution<float> variance(-kDeltaVariance,
-                                                        kDeltaVariance);
+  return iMaxTicks;
+}
 
-  const float timeToSpawn = kSpawnBaseTime / (kScaleVelocity * iGameVelocity);
+void ObstacleManager::updateSpawn(const float iGameVelocity) {
+  const float timeToSpawn = ComputeTimeToSpawn(iGameVelocity);
 
-  if (timeToSpawn <= accumulator) {
-    accumulator -= timeToSpawn;
+  if (timeToSpawn <= _accumulatorSpawn) {
+    _accumulatorSpawn -= timeToSpawn;
 
     _obstacles.emplace_back();
     _obstacles.back().init(::GetRndObstacleType(&_rndEngine));
   }
-  accumulator += Config::kDeltaTimeLogicUpdate;
+  _accumulatorSpawn += Config::kDeltaTimeLogicUpdate;
+}
+
+float ObstacleManager::ComputeTimeToSpawn(const float iGameVelocity) noexcept {
+  constexpr float kSpawnBaseTime = 3.f;
+  constexpr float kScaleVelocity = 0.002f;
+
+  return kSpawnBaseTime / (kScaleVelocity * iGameVelocity);
 }
 
 }  // namespace aimaze2
@@ -28,15 +28,25 @@ class ObstacleManager {
 
   void init(const SeedType iSeed);
   void update(const float iGameVelocity);
-  void draw(sf::RenderWindow* oRender) const;
+  void advance(const float iGameVelocity, const int iNumTicks);
+  void draw(SpriteBatch* oSprites, SpriteBatch* oDebug) const;
 
   const std::deque<Obstacle>& getObstacles() const noexcept;
 
+  /*! \brief Number of ticks (at most iMaxTicks) before the tick a new
+   *         obstacle is spawned.
+   */
+  int computeTicksToSpawn(const float iGameVelocity,
+                          const int iMaxTicks) const noexcept;
+
  private:
   Config::RndEngine _rndEngine;
   std::deque<Obstacle> _obstacles;
+  float _accumulatorSpawn;
 
   void updateSpawn(const float iGameVelocity);
+
+  static float ComputeTimeToSpawn(const float iGameVelocity) noexcept;
 };
 
 }  // namespace aimaze2
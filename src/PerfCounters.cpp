@@ -0,0 +1,163 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "PerfCounters.hpp"
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+#include <atomic>
+#include <cstring>
+
+namespace {
+
+using aimaze2::PerfCounters;
+
+// Bit i is set once the i-th event has been opened.
+std::atomic<unsigned> sAvailableEvents{0};
+
+#ifdef __linux__
+
+/*! \note Values are read in the order the events joined the group. */
+class ThreadGroup {
+ public:
+  ThreadGroup() {
+    _fds.fill(-1);
+
+    for (std::size_t i = 0; i < PerfCounters::kNumEvents; ++i) {
+      perf_event_attr attr;
+      std::memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      SetEventType(static_cast<PerfCounters::Event>(i), &attr);
+      attr.read_format = PERF_FORMAT_GROUP;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+
+      const int leaderFd = _numOpened == 0 ? -1 : _fds[0];
+      const int fd = static_cast<int>(
+          ::syscall(SYS_perf_event_open, &attr, 0, -1, leaderFd, 0));
+      if (fd == -1) {
+        continue;
+      }
+
+      _fds[_numOpened] = fd;
+      _events[_numOpened] = i;
+      ++_numOpened;
+      ::sAvailableEvents.fetch_or(1u << i, std::memory_order_relaxed);
+    }
+  }
+
+  ~ThreadGroup() {
+    for (std::size_t i = 0; i < _numOpened; ++i) {
+      ::close(_fds[i]);
+    }
+  }
+
+  ThreadGroup(const ThreadGroup&) = delete;
+  ThreadGroup& operator=(const ThreadGroup&) = delete;
+
+  bool read(PerfCounters::Values* oValues) const noexcept {
+    oValues->fill(0);
+    if (_numOpened == 0) {
+      return false;
+    }
+
+    // Layout of PERF_FORMAT_GROUP: number of events, then their values.
+    std::uint64_t buffer[1 + PerfCounters::kNumEvents];
+    if (::read(_fds[0], buffer, sizeof(buffer)) == -1) {
+      return false;
+    }
+    for (std::size_t i = 0; i < _numOpened && i < buffer[0]; ++i) {
+      (*oValues)[_events[i]] = buffer[1 + i];
+    }
+    return true;
+  }
+
+ private:
+  std::array<int, PerfCounters::kNumEvents> _fds;
+  std::array<std::size_t, PerfCounters::kNumEvents> _events{};
+  std::size_t _numOpened = 0;
+
+  static void SetEventType(const PerfCounters::Event iEvent,
+                           perf_event_attr* oAttr) noexcept {
+    oAttr->type = PERF_TYPE_HARDWARE;
+    switch (iEvent) {
+      case PerfCounters::Event::CYCLES:
+        oAttr->config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+      case PerfCounters::Event::INSTRUCTIONS:
+        oAttr->config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+      case PerfCounters::Event::L1D_MISSES:
+        oAttr->type = PERF_TYPE_HW_CACHE;
+        oAttr->config = PERF_COUNT_HW_CACHE_L1D |
+                        (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+                        (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+      case PerfCounters::Event::LLC_MISSES:
+        oAttr->config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+      case PerfCounters::Event::BRANCH_MISSES:
+        oAttr->config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+      case PerfCounters::Event::NUM_EVENTS:
+        break;
+    }
+  }
+};
+
+#endif  // __linux__
+
+}  // anonymous namespace
+
+namespace aimaze2 {
+
+bool PerfCounters::Read(Values* oValues) noexcept {
+#ifdef __linux__
+  thread_local const ::ThreadGroup tThreadGroup;
+  return tThreadGroup.read(oValues);
+#else
+  oValues->fill(0);
+  return false;
+#endif
+}
+
+bool PerfCounters::IsAvailable(const Event iEvent) noexcept {
+  const unsigned bit = 1u << static_cast<std::size_t>(iEvent);
+  return (::sAvailableEvents.load(std::memory_order_relaxed) & bit) != 0;
+}
+
+const char* PerfCounters::GetEventName(const Event iEvent) noexcept {
+  switch (iEvent) {
+    case Event::CYCLES:
+      return "Cycles";
+    case Event::INSTRUCTIONS:
+      return "Instructions";
+    case Event::L1D_MISSES:
+      return "L1D misses";
+    case Event::LLC_MISSES:
+      return "LLC misses";
+    case Event::BRANCH_MISSES:
+      return "Branch misses";
+    case Event::NUM_EVENTS:
+      break;
+  }
+  return "";
+}
+
+}  // namespace aimaze2
@@ -0,0 +1,64 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__PERF_COUNTERS__HPP
+#define AIMAZE2__PERF_COUNTERS__HPP
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace aimaze2 {
+
+/*! \brief Hardware counters of the calling thread, from perf_event_open.
+ *  \note Each thread opens its counters on its first read, as one group, so
+ *        that they all count over the same instructions. Events the kernel
+ *        or the CPU do not provide (e.g. in virtual machines, or with
+ *        perf_event_paranoid above 2) are left out of the group.
+ *        Only on Linux: elsewhere no event is available.
+ */
+class PerfCounters {
+ public:
+  static constexpr bool kEnabled = false;
+
+  enum class Event : std::size_t {
+    CYCLES,
+    INSTRUCTIONS,
+    L1D_MISSES,
+    LLC_MISSES,
+    BRANCH_MISSES,
+    NUM_EVENTS
+  };
+  static constexpr std::size_t kNumEvents =
+      static_cast<std::size_t>(Event::NUM_EVENTS);
+
+  using Values = std::array<std::uint64_t, kNumEvents>;
+
+  /*! \brief Reads the counters of the calling thread.
+   *  \return false if no event is available.
+   *  \note Unavailable events read as zero.
+   */
+  static bool Read(Values* oValues) noexcept;
+
+  /*! \return Whether the event could be opened by any thread so far. */
+  static bool IsAvailable(const Event iEvent) noexcept;
+
+  static const char* GetEventName(const Event iEvent) noexcept;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__PERF_COUNTERS__HPP
@@ -22,14 +22,10 @@
 namespace aimaze2 {
 
 void Player::init() {
-  std::get<TextureID::RUN_0>(_textures).loadFromFile("data/dinorun0000.png");
-  std::get<TextureID::RUN_1>(_textures).loadFromFile("data/dinorun0001.png");
-  std::get<TextureID::JUMP>(_textures).loadFromFile("data/dinoJump0000.png");
-  std::get<TextureID::DEAD>(_textures).loadFromFile("data/dinoDead0000.png");
-  std::get<TextureID::DUCK_0>(_textures).loadFromFile("data/dinoduck0000.png");
-  std::get<TextureID::DUCK_1>(_textures).loadFromFile("data/dinoduck0001.png");
+  SpriteAtlas::init();
 
   _playerSprite.setPosition(kPlayerPosition);
+  _previousPosition = kPlayerPosition;
 
   _idTexture = TextureID::RUN_0;
   _jumping = false;
@@ -42,20 +38,49 @@ void Player::init() {
 }
 
 void Player::update(const float iGameVelocity) {
+  _previousPosition = _playerSprite.getPosition();
   updateAnimation(iGameVelocity);
 
   if (_dead == false) {
     _playerSprite.move({0.f, _velocityY * Config::kDeltaTimeLogicUpdate});
-    applyGravity();
+    snapToGround();
   }
 }
 
-void Player::draw(sf::RenderWindow* oRender) const {
+void Player::advance(const float iGameVelocity, const int iNumTicks) {
+  assert(iNumTicks <= computeTicksToLand(iNumTicks));
+
+  TextureID idTexture = _idTexture;
+  for (int i = 0; i < iNumTicks; ++i) {
+    idTexture = stepAnimation(iGameVelocity);
+  }
+  assert(idTexture < kFrames.size());
+  _playerSprite.setTextureRect(SpriteAtlas::GetFrameRect(kFrames[idTexture]));
+
+  if (_dead == false) {
+    _previousPosition = _playerSprite.getPosition();
+    if (_jumping) {
+      // Same recurrence as `update`, without touching the sprite each tick.
+      auto position = _playerSprite.getPosition();
+      for (int i = 0; i < iNumTicks; ++i) {
+        _previousPosition.y = position.y;
+        position.y += _velocityY * Config::kDeltaTimeLogicUpdate;
+        _velocityY += _gravity * Config::kDeltaTimeLogicUpdate;
+      }
+      _playerSprite.setPosition(position);
+    } else {
+      snapToGround();
+    }
+  }
+}
+
+void Player::draw(SpriteBatch* oSprites, SpriteBatch* oDebug) const {
   if (_dead == false) {
-    oRender->draw(_playerSprite);
+    oSprites->addSprite(_playerSprite.getGlobalBounds(),
+                        _playerSprite.getTextureRect());
 
     if constexpr (Config::kDrawCollisionBox) {
-      drawCollisionBox(oRender);
+      drawCollisionBox(oDebug);
     }
   }
 }
@@ -94,14 +119,48 @@ void Player::duckOff() {
 
 sf::FloatRect Player::getCollisionBox() const {
   auto spriteBox = _playerSprite.getGlobalBounds();
-  spriteBox.width -= 50.f;
-  spriteBox.left += 25.f;
+  spriteBox.width -= 2.f * kOffsetCollisionBoxX;
+  spriteBox.left += kOffsetCollisionBoxX;
   spriteBox.height -= 10.f;
   spriteBox.top += 10.f;
 
   return spriteBox;
 }
 
+sf::Vector2f Player::getLastMotion() const noexcept {
+  return _playerSprite.getPosition() - _previousPosition;
+}
+
+bool Player::isJumping() const noexcept { return _jumping; }
+
+const sf::Vector2f& Player::getPosition() const noexcept {
+  return _playerSprite.getPosition();
+}
+
+float Player::getVelocityY() const noexcept { return _velocityY; }
+
+int Player::computeTicksToLand(const int iMaxTicks) const noexcept {
+  if (_dead || !_jumping) {
+    return iMaxTicks;
+  }
+
+  float positionY = _playerSprite.getPosition().y;
+  float velocityY = _velocityY;
+  for (int i = 0; i < iMaxTicks; ++i) {
+    positionY += velocityY * Config::kDeltaTimeLogicUpdate;
+    if (positionY >= kPlayerPosition.y) {
+      return i;
+    }
+    velocityY += _gravity * Config::kDeltaTimeLogicUpdate;
+  }
+
+  return iMaxTicks;
+}
+
+float Player::GetCollisionBoxLeft() noexcept {
+  return kPlayerPosition.x + kOffsetCollisionBoxX;
+}
+
 void Player::applyGravity() {
   if (_playerSprite.getPosition().y < kPlayerPosition.y) {
     _velocityY += _gravity * Config::kDeltaTimeLogicUpdate;
@@ -112,7 +171,21 @@ void Player::applyGravity() {
   }
 }
 
+void Player::snapToGround() {
+  // Landing or ducking moves the sprite at once: it is not a motion to sweep.
+  const sf::Vector2f position = _playerSprite.getPosition();
+  applyGravity();
+  _previousPosition += _playerSprite.getPosition() - position;
+}
+
 void Player::updateAnimation(const float iGameVelocity) {
+  const TextureID idTexture = stepAnimation(iGameVelocity);
+
+  assert(idTexture < kFrames.size());
+  _playerSprite.setTextureRect(SpriteAtlas::GetFrameRect(kFrames[idTexture]));
+}
+
+Player::TextureID Player::stepAnimation(const float iGameVelocity) noexcept {
   static constexpr float kScaleVelocityAnimation = 80.f;
 
   if (_dead == true) {
@@ -127,9 +200,7 @@ void Player::updateAnimation(const float iGameVelocity) {
     _idTexture = TextureID::RUN_0;
   }
 
-  assert(_idTexture < _textures.size());
-  _playerSprite.setTexture(_textures[_idTexture], true);
-
+  const TextureID currentTexture = _idTexture;
   const float timePerFrame = kScaleVelocityAnimation / iGameVelocity;
 
   if (timePerFrame <= _accumulatorAnimation) {
@@ -138,19 +209,12 @@ void Player::updateAnimation(const float iGameVelocity) {
   }
 
   _accumulatorAnimation += Config::kDeltaTimeLogicUpdate;
-}
 
-void Player::drawCollisionBox(sf::RenderWindow* oRender) const {
-  sf::RectangleShape box;
-
-  const auto collisionBox = getCollisionBox();
-  box.setSize(sf::Vector2f{collisionBox.width, collisionBox.height});
-  box.setOutlineColor(Config::kDebugColor);
-  box.setOutlineThickness(2.f);
-  box.setFillColor(sf::Color{0, 0, 0, 0});
-  box.setPosition(sf::Vector2f{collisionBox.left, collisionBox.top});
+  return currentTexture;
+}
 
-  oRender->draw(box);
+void Player::drawCollisionBox(SpriteBatch* oDebug) const {
+  oDebug->addOutline(getCollisionBox(), 2.f, Config::kDebugColor);
 }
 
 void Player::resetGroundPosition() {
@@ -19,6 +19,8 @@
 #define AIMAZE2__PLAYER__HPP
 #include <SFML/Graphics.hpp>
 #include <array>
+#include "SpriteAtlas.hpp"
+#include "SpriteBatch.hpp"
 
 namespace aimaze2 {
 
@@ -28,7 +30,13 @@ class Player {
 
   void init();
   void update(const float iGameVelocity);
-  void draw(sf::RenderWindow* oRender) const;
+
+  /*! \brief Advances the player by several logic ticks at once.
+   *  \note Preconditions: the player does not land within those ticks.
+   *  \see computeTicksToLand
+   */
+  void advance(const float iGameVelocity, const int iNumTicks);
+  void draw(SpriteBatch* oSprites, SpriteBatch* oDebug) const;
 
   void jump();
   void die(const sf::Vector2f& iNewPosition);
@@ -37,12 +45,36 @@ class Player {
 
   sf::FloatRect getCollisionBox() const;
 
+  /*! \brief Displacement of the player during the last logic tick. */
+  sf::Vector2f getLastMotion() const noexcept;
+
+  bool isJumping() const noexcept;
+
+  const sf::Vector2f& getPosition() const noexcept;
+  float getVelocityY() const noexcept;
+
+  /*! \brief Number of ticks (at most iMaxTicks) the player can be advanced
+   *         before the tick it lands on the ground.
+   */
+  int computeTicksToLand(const int iMaxTicks) const noexcept;
+
+  /*! \brief Left edge of the collision box of any living player. */
+  static float GetCollisionBoxLeft() noexcept;
+
  private:
   static constexpr std::size_t kNumTextures = 6;
+  static constexpr float kOffsetCollisionBoxX = 25.f;
   enum TextureID : std::size_t { RUN_0, RUN_1, JUMP, DEAD, DUCK_0, DUCK_1 };
+  static constexpr std::array<SpriteAtlas::FrameID, kNumTextures> kFrames{
+      SpriteAtlas::DINO_RUN_0,
+      SpriteAtlas::DINO_RUN_1,
+      SpriteAtlas::DINO_JUMP,
+      SpriteAtlas::DINO_DEAD,
+      SpriteAtlas::DINO_DUCK_0,
+      SpriteAtlas::DINO_DUCK_1};
 
-  std::array<sf::Texture, kNumTextures> _textures;
   sf::Sprite _playerSprite;
+  sf::Vector2f _previousPosition;
   TextureID _idTexture;
   bool _jumping;
   bool _dead;
@@ -52,8 +84,10 @@ class Player {
   float _accumulatorAnimation;
 
   void applyGravity();
+  void snapToGround();
   void updateAnimation(const float iGameVelocity);
-  void drawCollisionBox(sf::RenderWindow* oRender) const;
+  TextureID stepAnimation(const float iGameVelocity) noexcept;
+  void drawCollisionBox(SpriteBatch* oDebug) const;
   void resetGroundPosition();
 
   static TextureID NextFrameAnimation(const TextureID iTextureId) noexcept;
@@ -18,7 +18,9 @@
 #include "Population.hpp"
 #include <algorithm>
 #include <cassert>
+#include <unordered_map>
 #include <utility>
+#include "Profiler.hpp"
 
 namespace {
 
@@ -64,6 +66,12 @@ void Population::setAllFitness(std::vector<float> iFitness) {
 void Population::naturalSelection(ConfigEvolution::RndEngine* ioRndEngine) {
   speciate();
   killEmptySpecies();
+
+  _speciesSizesFound.clear();
+  for (const auto& species : _species) {
+    _speciesSizesFound.push_back(species.size());
+  }
+
   adjustFitnessWithinSpecies();
   sortSpecies();
   cullSpecies();
@@ -81,7 +89,69 @@ std::size_t Population::getSpeciesSize() const noexcept {
   return _species.size();
 }
 
+const std::vector<Species>& Population::getSpecies() const noexcept {
+  return _species;
+}
+
+const std::vector<std::size_t>& Population::getSpeciesSizesFound() const
+    noexcept {
+  return _speciesSizesFound;
+}
+
+void Population::computeMemoryUsage(std::size_t* oGenomes,
+                                    std::size_t* oSpecies,
+                                    std::size_t* oInnovationHistory) const
+    noexcept {
+  *oGenomes = _genomes.capacity() * sizeof(Genome);
+  for (const auto& genome : _genomes) {
+    *oGenomes += genome.computeDynamicMemoryUsage();
+  }
+
+  *oSpecies = _species.capacity() * sizeof(Species) +
+              _speciesSizesFound.capacity() * sizeof(std::size_t);
+  for (const auto& species : _species) {
+    *oSpecies += species.computeDynamicMemoryUsage();
+  }
+
+  *oInnovationHistory = _innovationHistory.computeDynamicMemoryUsage();
+}
+
+void Population::computeUniqueGenomes(
+    std::vector<std::size_t>* oUniqueGenomes,
+    std::vector<std::size_t>* oGroups) const {
+  oUniqueGenomes->clear();
+  oGroups->resize(_genomes.size());
+
+  // Groups sharing the same hash. Contents are compared on hash collision.
+  std::unordered_multimap<std::size_t, std::size_t> groupsByHash;
+  groupsByHash.reserve(_genomes.size());
+
+  for (std::size_t i = 0; i < _genomes.size(); ++i) {
+    const auto& genome = _genomes[i];
+    const std::size_t hash = genome.computeContentHash();
+    const auto range = groupsByHash.equal_range(hash);
+
+    const auto itFinder =
+        std::find_if(range.first,
+                     range.second,
+                     [this, &genome, oUniqueGenomes](const auto& iGroup) {
+                       const auto indexUnique = (*oUniqueGenomes)[iGroup.second];
+                       return _genomes[indexUnique].hasSameContent(genome);
+                     });
+
+    if (itFinder != range.second) {
+      (*oGroups)[i] = itFinder->second;
+    } else {
+      (*oGroups)[i] = oUniqueGenomes->size();
+      groupsByHash.emplace(hash, oUniqueGenomes->size());
+      oUniqueGenomes->push_back(i);
+    }
+  }
+}
+
 void Population::speciate() {
+  Profiler::ScopedTimer timer{Profiler::Phase::SPECIATE};
+
   for (auto& species : _species) {
     species.killAll();
   }
@@ -108,6 +178,8 @@ void Population::speciate() {
 }
 
 void Population::adjustFitnessWithinSpecies() {
+  Profiler::ScopedTimer timer{Profiler::Phase::ADJUST_FITNESS};
+
   for (const auto& species : _species) {
     const auto sizeSpecies = species.size();
     for (const auto genomeIndex : species) {
@@ -118,6 +190,8 @@ void Population::adjustFitnessWithinSpecies() {
 }
 
 void Population::updateFitnessSpecies() {
+  Profiler::ScopedTimer timer{Profiler::Phase::UPDATE_FITNESS_SPECIES};
+
   _sumOfFitnessSum = 0.f;
 
   for (auto& species : _species) {
@@ -144,6 +218,8 @@ void Population::updateFitnessSpecies() {
 }
 
 void Population::sortSpecies() {
+  Profiler::ScopedTimer timer{Profiler::Phase::SORT_SPECIES};
+
   // sort withint species best first
   for (auto& species : _species) {
     std::sort(species.begin(),
@@ -170,6 +246,8 @@ void Population::sortSpecies() {
 }
 
 void Population::killEmptySpecies() {
+  Profiler::ScopedTimer timer{Profiler::Phase::KILL_SPECIES};
+
   _species.erase(std::remove_if(_species.begin(),
                                 _species.end(),
                                 [](const Species& iSpecies) {
@@ -179,6 +257,8 @@ void Population::killEmptySpecies() {
 }
 
 void Population::killStaleSpecies() {
+  Profiler::ScopedTimer timer{Profiler::Phase::KILL_SPECIES};
+
   _species.erase(std::remove_if(_species.begin(),
                                 _species.end(),
                                 [](const Species& iSpecies) {
@@ -189,12 +269,16 @@ void Population::killStaleSpecies() {
 }
 
 void Population::cullSpecies() {
+  Profiler::ScopedTimer timer{Profiler::Phase::CULL_SPECIES};
+
   for (auto& species : _species) {
     species.cullLower(ConfigEvolution::kPercentageCullSpecies);
   }
 }
 
 void Population::evolutionEpoch(ConfigEvolution::RndEngine* ioRndEngine) {
+  Profiler::ScopedTimer timer{Profiler::Phase::EVOLUTION_EPOCH};
+
   assert(_sumOfFitnessSum != 0.f);
 
   const std::size_t kSizePopulation = _genomes.size();
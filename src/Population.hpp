@@ -39,6 +39,27 @@ class Population {
 
   std::size_t getPopulationSize() const noexcept;
   std::size_t getSpeciesSize() const noexcept;
+  const std::vector<Species>& getSpecies() const noexcept;
+
+  /*! \brief Sizes of the species found by the last natural selection.
+   *  \note Before culling and killing the stale species.
+   */
+  const std::vector<std::size_t>& getSpeciesSizesFound() const noexcept;
+
+  /*! \brief Bytes held by the genomes, the species (with their
+   *         representatives) and the innovation history.
+   */
+  void computeMemoryUsage(std::size_t* oGenomes,
+                          std::size_t* oSpecies,
+                          std::size_t* oInnovationHistory) const noexcept;
+
+  /*! \brief Groups the genomes with the same content.
+   *  \param [out] oUniqueGenomes   The index of one genome per group.
+   *  \param [out] oGroups          For each genome, the index of its group
+   *                                in oUniqueGenomes.
+   */
+  void computeUniqueGenomes(std::vector<std::size_t>* oUniqueGenomes,
+                            std::vector<std::size_t>* oGroups) const;
 
  private:
   using IndexGenome = Species::IndexGenome;
@@ -58,6 +79,7 @@ class Population {
   std::vector<Genome> _genomes;
   std::vector<float> _fitness;
   std::vector<Species> _species;
+  std::vector<std::size_t> _speciesSizesFound;
   float _sumOfFitnessSum;
 
   IndexGenome pickIndexGenomeFromSpecies(
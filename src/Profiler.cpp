@@ -0,0 +1,158 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "Profiler.hpp"
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+using aimaze2::PerfCounters;
+using aimaze2::Profiler;
+
+/*! \note Only the owner thread writes, so plain loads and stores are enough
+ *        (no read-modify-write); atomics let `Collect` read them safely.
+ */
+struct ThreadTotals {
+  std::array<std::atomic<std::uint64_t>, Profiler::kNumPhases> _nanoseconds{};
+  std::array<std::atomic<std::uint64_t>, Profiler::kNumPhases> _counts{};
+  std::array<std::array<std::atomic<std::uint64_t>, PerfCounters::kNumEvents>,
+             Profiler::kNumPhases>
+      _events{};
+  bool _excluded = false;  // Only accessed by the owner thread.
+};
+
+std::mutex sMutexRegistry;
+
+// Totals outlive their threads, so that no sample is lost.
+std::vector<std::unique_ptr<ThreadTotals>> sRegistry;
+
+ThreadTotals* RegisterThread() {
+  std::lock_guard<std::mutex> lock(sMutexRegistry);
+  sRegistry.push_back(std::make_unique<ThreadTotals>());
+  return sRegistry.back().get();
+}
+
+ThreadTotals* GetThreadTotals() {
+  thread_local ThreadTotals* const tThreadTotals = ::RegisterThread();
+  return tThreadTotals;
+}
+
+void Increment(std::atomic<std::uint64_t>* ioValue,
+               const std::uint64_t iDelta) noexcept {
+  ioValue->store(ioValue->load(std::memory_order_relaxed) + iDelta,
+                 std::memory_order_relaxed);
+}
+
+}  // anonymous namespace
+
+namespace aimaze2 {
+
+Profiler::Totals Profiler::Collect() {
+  Totals totals;
+
+  std::lock_guard<std::mutex> lock(::sMutexRegistry);
+  for (const auto& threadTotals : ::sRegistry) {
+    for (std::size_t i = 0; i < kNumPhases; ++i) {
+      totals._nanoseconds[i] +=
+          threadTotals->_nanoseconds[i].load(std::memory_order_relaxed);
+      totals._counts[i] +=
+          threadTotals->_counts[i].load(std::memory_order_relaxed);
+      for (std::size_t e = 0; e < PerfCounters::kNumEvents; ++e) {
+        totals._events[i][e] +=
+            threadTotals->_events[i][e].load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  return totals;
+}
+
+void Profiler::SetThreadExcluded(const bool iExcluded) noexcept {
+  ::GetThreadTotals()->_excluded = iExcluded;
+}
+
+const char* Profiler::GetPhaseName(const Phase iPhase) noexcept {
+  switch (iPhase) {
+    case Phase::SCENE_PHYSICS:
+      return "Scene physics";
+    case Phase::SCENE_COLLISION:
+      return "Scene collision";
+    case Phase::SCENE_SENSORS:
+      return "Scene sensors";
+    case Phase::SCENE_HUD:
+      return "Scene HUD";
+    case Phase::SCENE_IDLE_STEP:
+      return "Scene idle step";
+    case Phase::FEED_POPULATION:
+      return "Feed population";
+    case Phase::APPLY_ACTIONS:
+      return "Apply actions";
+    case Phase::INIT_GENERATION:
+      return "Init generation";
+    case Phase::SPECIATE:
+      return "Speciate";
+    case Phase::ADJUST_FITNESS:
+      return "Adjust fitness";
+    case Phase::SORT_SPECIES:
+      return "Sort species";
+    case Phase::CULL_SPECIES:
+      return "Cull species";
+    case Phase::UPDATE_FITNESS_SPECIES:
+      return "Update fitness species";
+    case Phase::KILL_SPECIES:
+      return "Kill species";
+    case Phase::EVOLUTION_EPOCH:
+      return "Evolution epoch";
+    case Phase::NUM_PHASES:
+      break;
+  }
+  return "";
+}
+
+void Profiler::AddSample(const Phase iPhase,
+                         const Clock::duration iDuration) noexcept {
+  ThreadTotals* const threadTotals = ::GetThreadTotals();
+  if (threadTotals->_excluded) {
+    return;
+  }
+
+  const auto index = static_cast<std::size_t>(iPhase);
+  const auto nanoseconds = static_cast<std::uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(iDuration)
+          .count());
+  ::Increment(&threadTotals->_nanoseconds[index], nanoseconds);
+  ::Increment(&threadTotals->_counts[index], 1);
+}
+
+void Profiler::AddEvents(const Phase iPhase,
+                         const PerfCounters::Values& iStart,
+                         const PerfCounters::Values& iEnd) noexcept {
+  ThreadTotals* const threadTotals = ::GetThreadTotals();
+  if (threadTotals->_excluded) {
+    return;
+  }
+
+  const auto index = static_cast<std::size_t>(iPhase);
+  for (std::size_t e = 0; e < PerfCounters::kNumEvents; ++e) {
+    ::Increment(&threadTotals->_events[index][e], iEnd[e] - iStart[e]);
+  }
+}
+
+}  // namespace aimaze2
@@ -0,0 +1,150 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__PROFILER__HPP
+#define AIMAZE2__PROFILER__HPP
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include "PerfCounters.hpp"
+#include "Tracer.hpp"
+
+namespace aimaze2 {
+
+/*! \brief Wall time spent in the phases of ticks and generations.
+ *  \note Each thread accumulates into its own totals, `Collect` sums them,
+ *        except the samples of threads while excluded (see
+ *        `SetThreadExcluded`).
+ *        Timers are traced as spans too (see Tracer), and count the
+ *        hardware events of the phases for which IsHardwareCounted is true
+ *        (see PerfCounters).
+ *        With kEnabled, Tracer::kEnabled and PerfCounters::kEnabled all
+ *        false the timers are empty and compile to nothing.
+ */
+class Profiler {
+ public:
+  static constexpr bool kEnabled = true;
+
+  enum class Phase : std::size_t {
+    SCENE_PHYSICS,
+    SCENE_COLLISION,
+    SCENE_SENSORS,
+    SCENE_HUD,
+    SCENE_IDLE_STEP,
+    FEED_POPULATION,
+    APPLY_ACTIONS,
+    INIT_GENERATION,
+    SPECIATE,
+    ADJUST_FITNESS,
+    SORT_SPECIES,
+    CULL_SPECIES,
+    UPDATE_FITNESS_SPECIES,
+    KILL_SPECIES,
+    EVOLUTION_EPOCH,
+    NUM_PHASES
+  };
+  static constexpr std::size_t kNumPhases =
+      static_cast<std::size_t>(Phase::NUM_PHASES);
+
+  struct Totals {
+    std::array<std::uint64_t, kNumPhases> _nanoseconds{};
+    std::array<std::uint64_t, kNumPhases> _counts{};
+    std::array<PerfCounters::Values, kNumPhases> _events{};
+  };
+
+  /*! \brief Phases around which hardware events are counted: inference,
+   *         physics, collision, speciation and reproduction.
+   *  \note Reading the counters is a system call, the other phases are
+   *        left out to keep the overhead on ticks low.
+   */
+  static constexpr bool IsHardwareCounted(const Phase iPhase) noexcept {
+    return iPhase == Phase::FEED_POPULATION ||
+           iPhase == Phase::SCENE_PHYSICS ||
+           iPhase == Phase::SCENE_COLLISION || iPhase == Phase::SPECIATE ||
+           iPhase == Phase::EVOLUTION_EPOCH;
+  }
+
+  /*! \brief Adds its lifetime to the totals of the phase. */
+  class ScopedTimer {
+   public:
+    explicit ScopedTimer(const Phase iPhase) noexcept {
+      if constexpr (kEnabled || Tracer::kEnabled || PerfCounters::kEnabled) {
+        _phase = iPhase;
+        _start = Clock::now();
+      }
+      if constexpr (PerfCounters::kEnabled) {
+        _counting =
+            IsHardwareCounted(iPhase) && PerfCounters::Read(&_eventsStart);
+      }
+    }
+
+    ~ScopedTimer() {
+      if constexpr (PerfCounters::kEnabled) {
+        PerfCounters::Values eventsEnd;
+        if (_counting && PerfCounters::Read(&eventsEnd)) {
+          AddEvents(_phase, _eventsStart, eventsEnd);
+        }
+      }
+      if constexpr (kEnabled || Tracer::kEnabled) {
+        const auto end = Clock::now();
+        if constexpr (kEnabled) {
+          AddSample(_phase, end - _start);
+        }
+        Tracer::AddSpan(GetPhaseName(_phase), _start, end);
+      }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+   private:
+    Phase _phase;
+    std::chrono::steady_clock::time_point _start;
+    PerfCounters::Values _eventsStart;
+    bool _counting = false;
+  };
+
+  /*! \brief Totals of all the threads since the start of the program.
+   *  \note Samples still being added by other threads may be missed.
+   */
+  static Totals Collect();
+
+  /*! \brief Leaves the samples of the calling thread out of the totals,
+   *         until it is included again.
+   *  \note For scenes simulated out of training (e.g. the exporter replays),
+   *        which would be counted in the phases of the training otherwise.
+   *        Their timers are still traced.
+   */
+  static void SetThreadExcluded(const bool iExcluded) noexcept;
+
+  static const char* GetPhaseName(const Phase iPhase) noexcept;
+
+ private:
+  using Clock = std::chrono::steady_clock;
+
+  static void AddSample(const Phase iPhase,
+                        const Clock::duration iDuration) noexcept;
+
+  static void AddEvents(const Phase iPhase,
+                        const PerfCounters::Values& iStart,
+                        const PerfCounters::Values& iEnd) noexcept;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__PROFILER__HPP
@@ -0,0 +1,74 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "SceneRenderer.hpp"
+#include <string>
+#include "Assets.hpp"
+#include "Config.hpp"
+#include "SpriteAtlas.hpp"
+
+namespace aimaze2 {
+
+void SceneRenderer::init() {
+  SpriteAtlas::init();
+  Assets::LoadFont("Font.ttf", &_font);
+
+  _scoreText.setFont(_font);
+  _scoreText.setFillColor(Config::kFillColor);
+  _scoreText.setCharacterSize(18);
+
+  _infoDrawner.init();
+  _genomeDrawn.reset();
+  _scoreDrawn = -1;
+}
+
+void SceneRenderer::draw(const SceneSnapshot& iSnapshot,
+                         sf::RenderTarget* oRender) {
+  if (iSnapshot._genomeDiagram != _genomeDrawn) {
+    _genomeDrawn = iSnapshot._genomeDiagram;
+    if (_genomeDrawn) {
+      _genomeDrawner.updateWithDiagram(*_genomeDrawn);
+    }
+  }
+  if (iSnapshot._score != _scoreDrawn) {
+    updateScoreText(iSnapshot._score);
+  }
+  _infoDrawner.update(iSnapshot._populationSize,
+                      iSnapshot._numAlive,
+                      iSnapshot._genomeInputs,
+                      iSnapshot._generationNum);
+
+  iSnapshot._groundBatch.draw(oRender);
+  iSnapshot._spriteBatch.draw(oRender, &SpriteAtlas::GetTexture());
+  iSnapshot._debugBatch.draw(oRender);
+  if (_genomeDrawn) {
+    _genomeDrawner.draw(oRender);
+  }
+  oRender->draw(_scoreText);
+  _infoDrawner.draw(oRender);
+}
+
+void SceneRenderer::updateScoreText(const long long iScore) {
+  _scoreDrawn = iScore;
+  _scoreText.setString(std::to_string(iScore));
+  _scoreText.setPosition({Config::kWindowWidth -
+                              _scoreText.getGlobalBounds().width -
+                              kHorizontalOffsetScore,
+                          kVerticalOffsetScore});
+}
+
+}  // namespace aimaze2
@@ -0,0 +1,53 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__SCENE_RENDERER__HPP
+#define AIMAZE2__SCENE_RENDERER__HPP
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include "GenomeDrawner.hpp"
+#include "InfoDrawner.hpp"
+#include "SceneSnapshot.hpp"
+
+namespace aimaze2 {
+
+/*! \brief Draws scene snapshots.
+ *  \note It owns all the rendering resources, so it can live on a thread
+ *        other than the logic one.
+ */
+class SceneRenderer {
+ public:
+  void init();
+  void draw(const SceneSnapshot& iSnapshot, sf::RenderTarget* oRender);
+
+ private:
+  static constexpr float kVerticalOffsetScore = 20.f;
+  static constexpr float kHorizontalOffsetScore = 50.f;
+
+  sf::Font _font;
+  sf::Text _scoreText;
+  GenomeDrawner _genomeDrawner;
+  InfoDrawner _infoDrawner;
+  std::shared_ptr<const GenomeDrawner::Diagram> _genomeDrawn;
+  long long _scoreDrawn;
+
+  void updateScoreText(const long long iScore);
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__SCENE_RENDERER__HPP
@@ -0,0 +1,45 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__SCENE_SNAPSHOT__HPP
+#define AIMAZE2__SCENE_SNAPSHOT__HPP
+#include <memory>
+#include <vector>
+#include "GenomeDrawner.hpp"
+#include "SpriteBatch.hpp"
+
+namespace aimaze2 {
+
+/*! \brief Everything the renderer needs to draw one frame of the scene.
+ *  \note It is filled by the logic thread and read by the render thread,
+ *        thus it must not refer to any object owned by the logic.
+ */
+struct SceneSnapshot {
+  SpriteBatch _groundBatch;
+  SpriteBatch _spriteBatch;
+  SpriteBatch _debugBatch;
+  long long _score;
+  std::size_t _populationSize;
+  std::size_t _numAlive;
+  int _generationNum;
+  std::vector<float> _genomeInputs;
+  std::shared_ptr<const GenomeDrawner::Diagram> _genomeDiagram;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__SCENE_SNAPSHOT__HPP
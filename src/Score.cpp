@@ -21,40 +21,32 @@
 namespace aimaze2 {
 
 void Score::init() {
-  _font.loadFromFile("data/Font.ttf");
-
-  _scoreText.setFont(_font);
-  _scoreText.setFillColor(Config::kFillColor);
-  _scoreText.setCharacterSize(18);
-
   _score = 0;
+  _accumulator = 0.f;
 }
 
 void Score::update(const float iGameVelocity) {
   updateScoreValue(iGameVelocity);
-
-  _scoreText.setString(std::to_string(_score));
-  _scoreText.setPosition({Config::kWindowWidth -
-                              _scoreText.getGlobalBounds().width -
-                              kHorizontalOffsetSprite,
-                          kVerticalOffsetSprite});
 }
 
-void Score::draw(sf::RenderWindow* oRender) const { oRender->draw(_scoreText); }
+void Score::advance(const float iGameVelocity, const int iNumTicks) {
+  for (int i = 0; i < iNumTicks; ++i) {
+    updateScoreValue(iGameVelocity);
+  }
+}
 
 long long Score::getValue() const noexcept { return _score; }
 
 void Score::updateScoreValue(const float iGameVelocity) {
   static constexpr float kScale = 35.f;
-  static float accumulator = 0.0f;
 
   const float timePerIncrement = kScale / iGameVelocity;
 
-  if (timePerIncrement <= accumulator) {
+  while (timePerIncrement <= _accumulator) {
     ++_score;
-    accumulator -= timePerIncrement;
+    _accumulator -= timePerIncrement;
   }
-  accumulator += Config::kDeltaTimeLogicUpdate;
+  _accumulator += Config::kDeltaTimeLogicUpdate;
 }
 
 }  // namespace aimaze2
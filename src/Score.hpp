@@ -25,17 +25,13 @@ class Score {
  public:
   void init();
   void update(const float iGameVelocity);
-  void draw(sf::RenderWindow* oRender) const;
+  void advance(const float iGameVelocity, const int iNumTicks);
 
   long long getValue() const noexcept;
 
  private:
-  static constexpr float kVerticalOffsetSprite = 20.f;
-  static constexpr float kHorizontalOffsetSprite = 50.f;
-
-  sf::Font _font;
-  sf::Text _scoreText;
   long long _score;
+  float _accumulator;
 
   void updateScoreValue(const float iGameVelocity);
 };
@@ -0,0 +1,308 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "SharedScene.hpp"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace {
+
+static_assert(std::atomic<std::uint32_t>::is_always_lock_free,
+              "The seqlock is shared among processes");
+static_assert(std::is_trivially_copyable_v<sf::Vertex>);
+
+template <typename T>
+std::size_t Clamp(const T iValue, const std::size_t iMax) {
+  return std::min(static_cast<std::size_t>(iValue), iMax);
+}
+
+}  // anonymous namespace
+
+namespace aimaze2 {
+
+struct SharedScene::Segment {
+  static constexpr std::uint32_t kMagic = 0x414d5a32;  // "AMZ2"
+  static constexpr std::size_t kNumBatches = 3;
+
+  struct Node {
+    std::int32_t _nodeID;
+    std::uint32_t _layer;
+  };
+  struct Link {
+    std::int32_t _nodeFromID;
+    std::int32_t _nodeToID;
+    float _weight;
+    std::uint32_t _enabled;
+  };
+
+  std::atomic<std::uint32_t> _magic;
+  std::atomic<std::uint32_t> _sequence;
+
+  std::int64_t _score;
+  std::uint64_t _populationSize;
+  std::uint64_t _numAlive;
+  std::int32_t _generationNum;
+  std::uint32_t _numInputs;
+  std::array<float, kMaxInputs> _genomeInputs;
+  std::array<std::uint32_t, kNumBatches> _numVertices;
+  std::array<std::array<sf::Vertex, kMaxVerticesPerBatch>, kNumBatches>
+      _vertices;
+
+  std::uint64_t _diagramVersion;
+  std::uint32_t _numLayers;
+  std::uint32_t _numNodes;
+  std::uint32_t _numLinks;
+  std::array<Node, kMaxNodes> _nodes;
+  std::array<Link, kMaxLinks> _links;
+};
+
+SharedScene::~SharedScene() { detach(); }
+
+bool SharedScene::create(const std::string& iName) {
+  detach();
+
+  // Viewers still attached to a previous segment keep their own mapping.
+  ::shm_unlink(iName.c_str());
+  const int fd = ::shm_open(iName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+  if (fd < 0) {
+    return false;
+  }
+
+  void* address = MAP_FAILED;
+  if (::ftruncate(fd, sizeof(Segment)) == 0) {
+    address = ::mmap(
+        nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    ::shm_unlink(iName.c_str());
+    return false;
+  }
+
+  // The segment is zero-filled: sequence 0 means nothing published yet.
+  _segment = new (address) Segment;
+  _segment->_sequence.store(0, std::memory_order_relaxed);
+  _segment->_diagramVersion = 0;
+  _segment->_numLayers = 0;
+  _segment->_numNodes = 0;
+  _segment->_numLinks = 0;
+  _segment->_magic.store(Segment::kMagic, std::memory_order_release);
+
+  _creator = true;
+  _name = iName;
+  _diagramVersion = 0;
+  _lastDiagramPublished.reset();
+  return true;
+}
+
+bool SharedScene::attach(const std::string& iName) {
+  detach();
+
+  const int fd = ::shm_open(iName.c_str(), O_RDONLY, 0);
+  if (fd < 0) {
+    return false;
+  }
+
+  struct stat status;
+  void* address = MAP_FAILED;
+  if (::fstat(fd, &status) == 0 &&
+      static_cast<std::size_t>(status.st_size) == sizeof(Segment)) {
+    address = ::mmap(nullptr, sizeof(Segment), PROT_READ, MAP_SHARED, fd, 0);
+  }
+  ::close(fd);
+  if (address == MAP_FAILED) {
+    return false;
+  }
+
+  _segment = static_cast<Segment*>(address);
+  if (_segment->_magic.load(std::memory_order_acquire) != Segment::kMagic) {
+    detach();
+    return false;
+  }
+
+  _creator = false;
+  _name = iName;
+  _lastSequence = 0;
+  _diagramVersion = 0;
+  _lastDiagramRead.reset();
+  return true;
+}
+
+void SharedScene::detach() {
+  if (_segment == nullptr) {
+    return;
+  }
+
+  ::munmap(_segment, sizeof(Segment));
+  if (_creator) {
+    ::shm_unlink(_name.c_str());
+  }
+  _segment = nullptr;
+  _creator = false;
+}
+
+bool SharedScene::isAttached() const noexcept { return _segment != nullptr; }
+
+void SharedScene::publish(const SceneSnapshot& iSnapshot) {
+  if (_segment == nullptr || _creator == false) {
+    return;
+  }
+
+  // Odd sequence: writing in progress.
+  const std::uint32_t sequence =
+      _segment->_sequence.load(std::memory_order_relaxed);
+  _segment->_sequence.store(sequence + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  _segment->_score = iSnapshot._score;
+  _segment->_populationSize = iSnapshot._populationSize;
+  _segment->_numAlive = iSnapshot._numAlive;
+  _segment->_generationNum = iSnapshot._generationNum;
+
+  const std::size_t numInputs =
+      ::Clamp(iSnapshot._genomeInputs.size(), kMaxInputs);
+  _segment->_numInputs = static_cast<std::uint32_t>(numInputs);
+  std::copy_n(iSnapshot._genomeInputs.cbegin(),
+              numInputs,
+              _segment->_genomeInputs.begin());
+
+  const std::array<const SpriteBatch*, Segment::kNumBatches> batches{
+      &iSnapshot._groundBatch, &iSnapshot._spriteBatch, &iSnapshot._debugBatch};
+  for (std::size_t i = 0; i < batches.size(); ++i) {
+    const std::size_t numVertices =
+        ::Clamp(batches[i]->getNumVertices(), kMaxVerticesPerBatch);
+    _segment->_numVertices[i] = static_cast<std::uint32_t>(numVertices);
+    std::copy_n(
+        batches[i]->getVertices(), numVertices, _segment->_vertices[i].begin());
+  }
+
+  // The diagram changes once per generation.
+  if (iSnapshot._genomeDiagram != _lastDiagramPublished) {
+    _lastDiagramPublished = iSnapshot._genomeDiagram;
+    if (_lastDiagramPublished) {
+      writeDiagram(*_lastDiagramPublished);
+    }
+  }
+
+  _segment->_sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool SharedScene::read(SceneSnapshot* oSnapshot) {
+  if (_segment == nullptr) {
+    return false;
+  }
+
+  const std::uint32_t sequence =
+      _segment->_sequence.load(std::memory_order_acquire);
+  if ((sequence & 1) != 0 || sequence == _lastSequence) {
+    return false;
+  }
+
+  _scratch._score = _segment->_score;
+  _scratch._populationSize = _segment->_populationSize;
+  _scratch._numAlive = _segment->_numAlive;
+  _scratch._generationNum = _segment->_generationNum;
+
+  const std::size_t numInputs = ::Clamp(_segment->_numInputs, kMaxInputs);
+  _scratch._genomeInputs.assign(_segment->_genomeInputs.cbegin(),
+                                _segment->_genomeInputs.cbegin() + numInputs);
+
+  const std::array<SpriteBatch*, Segment::kNumBatches> batches{
+      &_scratch._groundBatch, &_scratch._spriteBatch, &_scratch._debugBatch};
+  for (std::size_t i = 0; i < batches.size(); ++i) {
+    const std::size_t numVertices =
+        ::Clamp(_segment->_numVertices[i], kMaxVerticesPerBatch);
+    batches[i]->clear();
+    batches[i]->addVertices(_segment->_vertices[i].data(), numVertices);
+  }
+
+  std::shared_ptr<const GenomeDrawner::Diagram> diagram = _lastDiagramRead;
+  const std::uint64_t diagramVersion = _segment->_diagramVersion;
+  if (diagramVersion != 0 && (!diagram || diagramVersion != _diagramVersion)) {
+    diagram = readDiagram();
+  }
+
+  // Everything read above is valid only if no write happened meanwhile.
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (_segment->_sequence.load(std::memory_order_relaxed) != sequence) {
+    return false;
+  }
+
+  _lastSequence = sequence;
+  _diagramVersion = diagramVersion;
+  _lastDiagramRead = diagram;
+  _scratch._genomeDiagram = diagram;
+  std::swap(*oSnapshot, _scratch);
+  return true;
+}
+
+void SharedScene::writeDiagram(const GenomeDrawner::Diagram& iDiagram) {
+  const std::size_t numNodes = ::Clamp(iDiagram._nodes.size(), kMaxNodes);
+  const std::size_t numLinks = ::Clamp(iDiagram._links.size(), kMaxLinks);
+
+  _segment->_numLayers = static_cast<std::uint32_t>(iDiagram._numLayers);
+  _segment->_numNodes = static_cast<std::uint32_t>(numNodes);
+  _segment->_numLinks = static_cast<std::uint32_t>(numLinks);
+  for (std::size_t i = 0; i < numNodes; ++i) {
+    const auto& node = iDiagram._nodes[i];
+    _segment->_nodes[i] = Segment::Node{
+        node._nodeID, static_cast<std::uint32_t>(node._layer)};
+  }
+  for (std::size_t i = 0; i < numLinks; ++i) {
+    const auto& link = iDiagram._links[i];
+    _segment->_links[i] = Segment::Link{
+        link._nodeFromID, link._nodeToID, link._weight, link._enabled};
+  }
+
+  _segment->_diagramVersion = ++_diagramVersion;
+}
+
+std::shared_ptr<const GenomeDrawner::Diagram> SharedScene::readDiagram()
+    const {
+  auto diagram = std::make_shared<GenomeDrawner::Diagram>();
+
+  const std::size_t numLayers = _segment->_numLayers;
+  const std::size_t numNodes = ::Clamp(_segment->_numNodes, kMaxNodes);
+  const std::size_t numLinks = ::Clamp(_segment->_numLinks, kMaxLinks);
+
+  diagram->_numLayers = numLayers;
+  for (std::size_t i = 0; i < numNodes; ++i) {
+    const auto& node = _segment->_nodes[i];
+    // A torn read must not break the drawer, the result is discarded anyway.
+    if (node._nodeID >= 0 && node._layer < numLayers) {
+      diagram->_nodes.push_back(
+          GenomeDrawner::Diagram::Node{node._nodeID, node._layer});
+    }
+  }
+  for (std::size_t i = 0; i < numLinks; ++i) {
+    const auto& link = _segment->_links[i];
+    diagram->_links.push_back(GenomeDrawner::Diagram::Link{
+        link._nodeFromID, link._nodeToID, link._weight, link._enabled != 0});
+  }
+
+  return diagram;
+}
+
+}  // namespace aimaze2
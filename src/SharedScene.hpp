@@ -0,0 +1,84 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__SHARED_SCENE__HPP
+#define AIMAZE2__SHARED_SCENE__HPP
+#include <cstdint>
+#include <memory>
+#include <string>
+#include "GenomeDrawner.hpp"
+#include "SceneSnapshot.hpp"
+
+namespace aimaze2 {
+
+/*! \brief Scene snapshots published to other processes (POSIX shared memory).
+ *  \note One process creates the segment and publishes into it, any number
+ *        of viewers attach to it and read. The segment is guarded by a
+ *        seqlock: the publisher never waits for readers, a reader just
+ *        retries later if the snapshot changed while it was reading.
+ *        Contents exceeding the capacities of the segment are truncated.
+ */
+class SharedScene {
+ public:
+  static constexpr std::size_t kMaxVerticesPerBatch = 4096;
+  static constexpr std::size_t kMaxInputs = 16;
+  static constexpr std::size_t kMaxNodes = 512;
+  static constexpr std::size_t kMaxLinks = 2048;
+
+  SharedScene() = default;
+  SharedScene(const SharedScene&) = delete;
+  SharedScene& operator=(const SharedScene&) = delete;
+  ~SharedScene();
+
+  /*! \brief Creates the segment to publish into, replacing a previous one. */
+  bool create(const std::string& iName);
+
+  /*! \brief Maps an existing segment, read only. */
+  bool attach(const std::string& iName);
+
+  /*! \brief Unmaps the segment, the creator also removes it. */
+  void detach();
+
+  bool isAttached() const noexcept;
+
+  void publish(const SceneSnapshot& iSnapshot);
+
+  /*! \brief Reads the latest snapshot, if it is newer than the last one read.
+   *  \return false if there is nothing new, or the snapshot was being
+   *          written. In that case oSnapshot is left untouched.
+   */
+  bool read(SceneSnapshot* oSnapshot);
+
+ private:
+  struct Segment;
+
+  Segment* _segment = nullptr;
+  bool _creator = false;
+  std::string _name;
+  std::uint32_t _lastSequence = 0;
+  std::shared_ptr<const GenomeDrawner::Diagram> _lastDiagramPublished;
+  std::uint64_t _diagramVersion = 0;
+  std::shared_ptr<const GenomeDrawner::Diagram> _lastDiagramRead;
+  SceneSnapshot _scratch;
+
+  void writeDiagram(const GenomeDrawner::Diagram& iDiagram);
+  std::shared_ptr<const GenomeDrawner::Diagram> readDiagram() const;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__SHARED_SCENE__HPP
@@ -71,6 +71,11 @@ void Species::increaseStaleness() noexcept { ++_staleness; }
 
 int Species::getStaleness() const noexcept { return _staleness; }
 
+std::size_t Species::computeDynamicMemoryUsage() const noexcept {
+  return _representative.computeDynamicMemoryUsage() +
+         _genomeIndices.capacity() * sizeof(IndexGenome);
+}
+
 void Species::cullLower(const float iPercentage) {
   assert(iPercentage >= 0.f && iPercentage <= 1.f);
   const std::size_t toErase =
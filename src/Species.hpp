@@ -54,6 +54,9 @@ class Species {
 
   void cullLower(const float iPercentage);
 
+  /*! \note sizeof(Species) is not included. */
+  std::size_t computeDynamicMemoryUsage() const noexcept;
+
  private:
   Genome _representative;  // TODO(biagio): one day try to use shared_ptr
   Container _genomeIndices;
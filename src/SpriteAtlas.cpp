@@ -0,0 +1,80 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "SpriteAtlas.hpp"
+#include <algorithm>
+#include <cassert>
+#include "Assets.hpp"
+
+namespace {
+
+constexpr std::array<const char*, aimaze2::SpriteAtlas::kNumFrames>
+    kFramePaths{"dinorun0000.png",
+                "dinorun0001.png",
+                "dinoJump0000.png",
+                "dinoDead0000.png",
+                "dinoduck0000.png",
+                "dinoduck0001.png",
+                "cactusSmall0000.png",
+                "cactusBig0000.png",
+                "cactusSmallMany0000.png",
+                "berd.png",
+                "berd2.png"};
+
+}  // anonymous namespace
+
+namespace aimaze2 {
+
+void SpriteAtlas::init() {
+  std::call_once(kInitFlag, [] {
+    std::array<sf::Image, kNumFrames> frames;
+    unsigned int width = 0;
+    unsigned int height = 0;
+    for (std::size_t i = 0; i < kNumFrames; ++i) {
+      Assets::LoadImage(::kFramePaths[i], &frames[i]);
+      width += frames[i].getSize().x + kPadding;
+      height = std::max(height, frames[i].getSize().y);
+    }
+
+    // Frames are laid out on a single row.
+    kImage.create(width, height, sf::Color{0, 0, 0, 0});
+    int left = 0;
+    for (std::size_t i = 0; i < kNumFrames; ++i) {
+      const auto size = frames[i].getSize();
+      kImage.copy(frames[i], left, 0);
+      kFrameRects[i] = sf::IntRect{
+          left, 0, static_cast<int>(size.x), static_cast<int>(size.y)};
+      left += static_cast<int>(size.x) + kPadding;
+    }
+
+    kInitialized = true;
+  });
+}
+
+const sf::IntRect& SpriteAtlas::GetFrameRect(const FrameID iFrameID) noexcept {
+  assert(kInitialized);
+  assert(iFrameID < kFrameRects.size());
+  return kFrameRects[iFrameID];
+}
+
+const sf::Texture& SpriteAtlas::GetTexture() {
+  assert(kInitialized);
+  std::call_once(kUploadFlag, [] { kTexture.loadFromImage(kImage); });
+  return kTexture;
+}
+
+}  // namespace aimaze2
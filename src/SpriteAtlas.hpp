@@ -0,0 +1,67 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__SPRITE_ATLAS__HPP
+#define AIMAZE2__SPRITE_ATLAS__HPP
+#include <SFML/Graphics.hpp>
+#include <array>
+#include <mutex>
+
+namespace aimaze2 {
+
+/*! \brief All the frames of dinos, cactuses and birds in a single texture.
+ *  \note The frame rectangles are available after `init`, which does not
+ *        need a graphic context. The texture is uploaded on first use.
+ *        Both are safe to be called from several threads.
+ */
+class SpriteAtlas {
+ public:
+  enum FrameID : std::size_t {
+    DINO_RUN_0,
+    DINO_RUN_1,
+    DINO_JUMP,
+    DINO_DEAD,
+    DINO_DUCK_0,
+    DINO_DUCK_1,
+    CACTUS_SMALL,
+    CACTUS_BIG,
+    CACTUS_LARGE,
+    BIRD_0,
+    BIRD_1
+  };
+  static constexpr std::size_t kNumFrames = 11;
+
+  static void init();
+
+  static const sf::IntRect& GetFrameRect(const FrameID iFrameID) noexcept;
+
+  static const sf::Texture& GetTexture();
+
+ private:
+  static constexpr int kPadding = 1;
+
+  static inline std::once_flag kInitFlag;
+  static inline std::once_flag kUploadFlag;
+  static inline bool kInitialized = false;
+  static inline sf::Image kImage;
+  static inline sf::Texture kTexture;
+  static inline std::array<sf::IntRect, kNumFrames> kFrameRects;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__SPRITE_ATLAS__HPP
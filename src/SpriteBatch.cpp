@@ -0,0 +1,101 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "SpriteBatch.hpp"
+
+namespace aimaze2 {
+
+void SpriteBatch::clear() noexcept { _vertices.clear(); }
+
+void SpriteBatch::addSprite(const sf::FloatRect& iBounds,
+                            const sf::IntRect& iTextureRect,
+                            const sf::Color& iColor) {
+  const float right = iBounds.left + iBounds.width;
+  const float bottom = iBounds.top + iBounds.height;
+  const float texLeft = static_cast<float>(iTextureRect.left);
+  const float texTop = static_cast<float>(iTextureRect.top);
+  const float texRight = texLeft + static_cast<float>(iTextureRect.width);
+  const float texBottom = texTop + static_cast<float>(iTextureRect.height);
+
+  _vertices.append(
+      sf::Vertex{{iBounds.left, iBounds.top}, iColor, {texLeft, texTop}});
+  _vertices.append(sf::Vertex{{right, iBounds.top}, iColor, {texRight, texTop}});
+  _vertices.append(sf::Vertex{{right, bottom}, iColor, {texRight, texBottom}});
+  _vertices.append(
+      sf::Vertex{{iBounds.left, bottom}, iColor, {texLeft, texBottom}});
+}
+
+void SpriteBatch::addRect(const sf::FloatRect& iRect, const sf::Color& iColor) {
+  const float right = iRect.left + iRect.width;
+  const float bottom = iRect.top + iRect.height;
+
+  _vertices.append(sf::Vertex{{iRect.left, iRect.top}, iColor});
+  _vertices.append(sf::Vertex{{right, iRect.top}, iColor});
+  _vertices.append(sf::Vertex{{right, bottom}, iColor});
+  _vertices.append(sf::Vertex{{iRect.left, bottom}, iColor});
+}
+
+void SpriteBatch::addOutline(const sf::FloatRect& iRect,
+                             const float iThickness,
+                             const sf::Color& iColor) {
+  const float left = iRect.left - iThickness;
+  const float top = iRect.top - iThickness;
+  const float width = iRect.width + 2.f * iThickness;
+  const float height = iRect.height + 2.f * iThickness;
+
+  addRect(sf::FloatRect{left, top, width, iThickness}, iColor);
+  addRect(sf::FloatRect{left, top + height - iThickness, width, iThickness},
+          iColor);
+  addRect(sf::FloatRect{left, iRect.top, iThickness, iRect.height}, iColor);
+  addRect(sf::FloatRect{left + width - iThickness,
+                        iRect.top,
+                        iThickness,
+                        iRect.height},
+          iColor);
+}
+
+void SpriteBatch::draw(sf::RenderTarget* oRender,
+                       const sf::Texture* iTexture) const {
+  if (_vertices.getVertexCount() == 0) {
+    return;
+  }
+
+  sf::RenderStates states;
+  states.texture = iTexture;
+  oRender->draw(_vertices, states);
+}
+
+std::size_t SpriteBatch::getNumQuads() const noexcept {
+  return _vertices.getVertexCount() / 4;
+}
+
+std::size_t SpriteBatch::getNumVertices() const noexcept {
+  return _vertices.getVertexCount();
+}
+
+const sf::Vertex* SpriteBatch::getVertices() const noexcept {
+  return _vertices.getVertexCount() ? &_vertices[0] : nullptr;
+}
+
+void SpriteBatch::addVertices(const sf::Vertex* iVertices,
+                              const std::size_t iNumVertices) {
+  for (std::size_t i = 0; i < iNumVertices; ++i) {
+    _vertices.append(iVertices[i]);
+  }
+}
+
+}  // namespace aimaze2
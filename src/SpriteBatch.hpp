@@ -0,0 +1,58 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__SPRITE_BATCH__HPP
+#define AIMAZE2__SPRITE_BATCH__HPP
+#include <SFML/Graphics.hpp>
+
+namespace aimaze2 {
+
+/*! \brief Collects quads to be drawn with a single draw call.
+ *  \note All the textured quads of a batch must refer to the same texture.
+ */
+class SpriteBatch {
+ public:
+  void clear() noexcept;
+
+  void addSprite(const sf::FloatRect& iBounds,
+                 const sf::IntRect& iTextureRect,
+                 const sf::Color& iColor = sf::Color{255, 255, 255});
+
+  void addRect(const sf::FloatRect& iRect, const sf::Color& iColor);
+
+  /*! \brief Adds the outline of a rectangle, drawn outside of it. */
+  void addOutline(const sf::FloatRect& iRect,
+                  const float iThickness,
+                  const sf::Color& iColor);
+
+  void draw(sf::RenderTarget* oRender,
+            const sf::Texture* iTexture = nullptr) const;
+
+  std::size_t getNumQuads() const noexcept;
+
+  /*! \brief Raw vertices of the quads, e.g. to copy the batch around. */
+  std::size_t getNumVertices() const noexcept;
+  const sf::Vertex* getVertices() const noexcept;
+  void addVertices(const sf::Vertex* iVertices, const std::size_t iNumVertices);
+
+ private:
+  sf::VertexArray _vertices{sf::Quads};
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__SPRITE_BATCH__HPP
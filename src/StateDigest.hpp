@@ -0,0 +1,59 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__STATE_DIGEST__HPP
+#define AIMAZE2__STATE_DIGEST__HPP
+#include <cstdint>
+#include <cstring>
+
+namespace aimaze2 {
+
+/*! \brief Rolling FNV-1a hash of a sequence of values.
+ *  \note Floats are hashed by their bits: two states have the same digest
+ *        only if they are bit-identical.
+ */
+class StateDigest {
+ public:
+  void add(const std::uint64_t iValue) noexcept {
+    addBytes(&iValue, sizeof(iValue));
+  }
+
+  void add(const float iValue) noexcept {
+    std::uint32_t bits;
+    std::memcpy(&bits, &iValue, sizeof(bits));
+    addBytes(&bits, sizeof(bits));
+  }
+
+  std::uint64_t getValue() const noexcept { return _value; }
+
+ private:
+  static constexpr std::uint64_t kOffsetBasis = 0xcbf29ce484222325ull;
+  static constexpr std::uint64_t kPrime = 0x100000001b3ull;
+
+  std::uint64_t _value = kOffsetBasis;
+
+  void addBytes(const void* iData, const std::size_t iSize) noexcept {
+    const auto* bytes = static_cast<const unsigned char*>(iData);
+    for (std::size_t i = 0; i < iSize; ++i) {
+      _value = (_value ^ bytes[i]) * kPrime;
+    }
+  }
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__STATE_DIGEST__HPP
@@ -0,0 +1,239 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "Telemetry.hpp"
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+namespace {
+
+// E.g. "Scene physics" becomes "scene_physics".
+std::string ToColumnName(const char* iName) {
+  std::string name = iName;
+  for (char& c : name) {
+    c = c == ' ' ? '_'
+                 : static_cast<char>(
+                       std::tolower(static_cast<unsigned char>(c)));
+  }
+  return name;
+}
+
+/*! \return Whether records with the header can be appended to the file:
+ *          either it is empty (or missing) or it starts with the header.
+ */
+bool IsHeaderCompatible(const std::filesystem::path& iFilePath,
+                        const std::string& iHeader) {
+  std::ifstream file{iFilePath};
+  std::string firstLine;
+  if (!file || !std::getline(file, firstLine)) {
+    return true;
+  }
+  return firstLine + '\n' == iHeader;
+}
+
+// E.g. "telemetry.csv" with suffix 2 becomes "telemetry.2.csv".
+std::filesystem::path AddSuffix(const std::filesystem::path& iFilePath,
+                                const int iSuffix) {
+  std::filesystem::path filePath = iFilePath;
+  filePath.replace_filename(iFilePath.stem().string() + '.' +
+                            std::to_string(iSuffix) +
+                            iFilePath.extension().string());
+  return filePath;
+}
+
+}  // anonymous namespace
+
+namespace aimaze2 {
+
+Telemetry::~Telemetry() { close(); }
+
+bool Telemetry::open(const char* iFilePath) {
+  close();
+
+  // Columns change between builds: never append under another header.
+  const std::string header = FormatHeader();
+  _filePath = iFilePath;
+  for (int suffix = 1; !::IsHeaderCompatible(_filePath, header); ++suffix) {
+    _filePath = ::AddSuffix(iFilePath, suffix).string();
+  }
+
+  _file = std::fopen(_filePath.c_str(), "a");
+  if (_file == nullptr) {
+    return false;
+  }
+  std::fseek(_file, 0, SEEK_END);
+  if (std::ftell(_file) == 0) {
+    std::fputs(header.c_str(), _file);
+  }
+
+  _closing = false;
+  _thread = std::thread{&Telemetry::writeLoop, this};
+  return true;
+}
+
+const std::string& Telemetry::getFilePath() const noexcept {
+  return _filePath;
+}
+
+void Telemetry::record(const Record& iRecord) {
+  if (_file == nullptr) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _records.push_back(iRecord);
+  }
+  _condition.notify_one();
+}
+
+void Telemetry::close() {
+  if (_file == nullptr) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock{_mutex};
+    _closing = true;
+  }
+  _condition.notify_one();
+  _thread.join();
+
+  std::fclose(_file);
+  _file = nullptr;
+}
+
+void Telemetry::writeLoop() {
+  std::deque<Record> records;
+
+  while (true) {
+    std::unique_lock<std::mutex> lock{_mutex};
+    _condition.wait(lock, [this] { return _closing || !_records.empty(); });
+    records.swap(_records);
+    const bool closing = _closing;
+    lock.unlock();
+
+    for (const auto& record : records) {
+      writeRecord(record);
+    }
+    records.clear();
+    std::fflush(_file);
+
+    if (closing) {
+      return;
+    }
+  }
+}
+
+std::string Telemetry::FormatHeader() {
+  std::string header =
+      "seed,generation,ticks,idle_ticks,wall_time_s,cpu_time_s,"
+      "fitness_max,fitness_mean,fitness_median,"
+      "species_found,species,species_size_max,species_size_mean,"
+      "staleness_max,staleness_mean,nodes_max,nodes_mean,"
+      "connections_max,connections_mean,layers_max,layers_mean";
+
+  for (std::size_t i = 0; i < Profiler::kNumPhases; ++i) {
+    header += ',';
+    header +=
+        ::ToColumnName(Profiler::GetPhaseName(static_cast<Profiler::Phase>(i)));
+    header += "_ms";
+  }
+
+  // E.g. "scene_physics_l1d_misses".
+  for (std::size_t i = 0; i < Profiler::kNumPhases; ++i) {
+    const auto phase = static_cast<Profiler::Phase>(i);
+    if (!Profiler::IsHardwareCounted(phase)) {
+      continue;
+    }
+    const std::string phaseName = ::ToColumnName(Profiler::GetPhaseName(phase));
+    for (std::size_t e = 0; e < PerfCounters::kNumEvents; ++e) {
+      header += ',';
+      header += phaseName;
+      header += '_';
+      header += ::ToColumnName(
+          PerfCounters::GetEventName(static_cast<PerfCounters::Event>(e)));
+    }
+  }
+
+  header +=
+      ",mem_genomes,mem_species,mem_innovation_history,mem_players,"
+      "mem_obstacles,allocations,allocated_bytes\n";
+  return header;
+}
+
+void Telemetry::writeRecord(const Record& iRecord) {
+  std::fprintf(_file,
+               "%llu,%d,%zu,%zu,%.3f,%.3f,%g,%g,%g,%zu,%zu,%zu,%g,%d,%g,"
+               "%d,%g,%d,%g,%d,%g",
+               static_cast<unsigned long long>(iRecord._seed),
+               iRecord._generationNum,
+               iRecord._numTicks,
+               iRecord._numIdleTicks,
+               iRecord._wallTime,
+               iRecord._cpuTime,
+               iRecord._fitnessMax,
+               iRecord._fitnessMean,
+               iRecord._fitnessMedian,
+               iRecord._numSpeciesFound,
+               iRecord._numSpecies,
+               iRecord._speciesSizeMax,
+               iRecord._speciesSizeMean,
+               iRecord._stalenessMax,
+               iRecord._stalenessMean,
+               iRecord._nodesMax,
+               iRecord._nodesMean,
+               iRecord._connectionsMax,
+               iRecord._connectionsMean,
+               iRecord._layersMax,
+               iRecord._layersMean);
+  for (const double phaseTime : iRecord._phaseTimes) {
+    std::fprintf(_file, ",%.3f", phaseTime);
+  }
+
+  for (std::size_t i = 0; i < Profiler::kNumPhases; ++i) {
+    if (!Profiler::IsHardwareCounted(static_cast<Profiler::Phase>(i))) {
+      continue;
+    }
+    for (std::size_t e = 0; e < PerfCounters::kNumEvents; ++e) {
+      if (PerfCounters::kEnabled &&
+          PerfCounters::IsAvailable(static_cast<PerfCounters::Event>(e))) {
+        std::fprintf(_file,
+                     ",%llu",
+                     static_cast<unsigned long long>(
+                         iRecord._phaseEvents[i][e]));
+      } else {
+        std::fputc(',', _file);
+      }
+    }
+  }
+
+  const MemoryReport& memory = iRecord._memory;
+  std::fprintf(_file,
+               ",%zu,%zu,%zu,%zu,%zu,%llu,%llu\n",
+               memory._genomes,
+               memory._species,
+               memory._innovationHistory,
+               memory._players,
+               memory._obstacles,
+               static_cast<unsigned long long>(memory._numAllocations),
+               static_cast<unsigned long long>(memory._numAllocatedBytes));
+}
+
+}  // namespace aimaze2
@@ -0,0 +1,106 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__TELEMETRY__HPP
+#define AIMAZE2__TELEMETRY__HPP
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "MemoryReport.hpp"
+#include "Profiler.hpp"
+
+namespace aimaze2 {
+
+/*! \brief Appends one CSV line per generation to a file.
+ *  \note Records are formatted and written by a background thread, so that
+ *        the logic thread only queues them. Several runs can share the same
+ *        file: the header is written only when the file is empty. A file
+ *        with other columns (e.g. from another build) is left untouched, the
+ *        records go to a suffixed file instead (see `getFilePath`).
+ *        Hardware events are written for the phases where they are counted,
+ *        left empty when not available.
+ */
+class Telemetry {
+ public:
+  struct Record {
+    std::uint64_t _seed = 0;
+    int _generationNum = 0;
+    std::size_t _numTicks = 0;
+    std::size_t _numIdleTicks = 0;
+    double _wallTime = 0.0;  // Seconds of the generation.
+    double _cpuTime = 0.0;   // Seconds of the process since the start.
+    float _fitnessMax = 0.f;
+    float _fitnessMean = 0.f;
+    float _fitnessMedian = 0.f;
+    std::size_t _numSpeciesFound = 0;  // Before killing the stale ones.
+    std::size_t _numSpecies = 0;
+    std::size_t _speciesSizeMax = 0;
+    float _speciesSizeMean = 0.f;
+    int _stalenessMax = 0;
+    float _stalenessMean = 0.f;
+    int _nodesMax = 0;
+    float _nodesMean = 0.f;
+    int _connectionsMax = 0;
+    float _connectionsMean = 0.f;
+    int _layersMax = 0;
+    float _layersMean = 0.f;
+    std::array<double, Profiler::kNumPhases> _phaseTimes{};  // Milliseconds.
+    std::array<PerfCounters::Values, Profiler::kNumPhases> _phaseEvents{};
+    MemoryReport _memory;
+  };
+
+  Telemetry() = default;
+  Telemetry(const Telemetry&) = delete;
+  Telemetry& operator=(const Telemetry&) = delete;
+  ~Telemetry();
+
+  /*! \return false if the file cannot be opened. */
+  bool open(const char* iFilePath);
+
+  /*! \brief The file actually written: iFilePath of `open`, or a suffixed
+   *         version of it if iFilePath has a different header.
+   */
+  const std::string& getFilePath() const noexcept;
+
+  /*! \note Ignored if the file is not open. */
+  void record(const Record& iRecord);
+
+  /*! \brief Writes the pending records and closes the file. */
+  void close();
+
+ private:
+  std::FILE* _file = nullptr;
+  std::string _filePath;
+  std::thread _thread;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::deque<Record> _records;
+  bool _closing = false;
+
+  void writeLoop();
+  static std::string FormatHeader();
+  void writeRecord(const Record& iRecord);
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__TELEMETRY__HPP
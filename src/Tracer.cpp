@@ -0,0 +1,186 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include "Tracer.hpp"
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using aimaze2::Tracer;
+
+constexpr std::size_t kRingCapacity = 1 << 16;
+constexpr auto kPeriodFlush = std::chrono::milliseconds{100};
+
+/*! \note Single producer (the owner thread), single consumer (the flush). */
+struct Ring {
+  std::array<Tracer::Event, kRingCapacity> _events;
+  std::atomic<std::uint64_t> _head = 0;
+  std::atomic<std::uint64_t> _tail = 0;
+  std::atomic<std::uint64_t> _numDropped = 0;
+  int _threadID = 0;
+};
+
+// Guards the registry and the file.
+std::mutex sMutex;
+std::vector<std::unique_ptr<Ring>> sRings;
+std::FILE* sFile = nullptr;
+bool sFirstEvent = true;
+const Tracer::Clock::time_point kOrigin = Tracer::Clock::now();
+
+std::thread sFlushThread;
+std::condition_variable sFlushCondition;
+bool sStopping = false;
+
+Ring* RegisterThread() {
+  std::lock_guard<std::mutex> lock(sMutex);
+  sRings.push_back(std::make_unique<Ring>());
+  sRings.back()->_threadID = static_cast<int>(sRings.size());
+  return sRings.back().get();
+}
+
+double ToMicroseconds(const Tracer::Clock::duration iDuration) {
+  return std::chrono::duration<double, std::micro>(iDuration).count();
+}
+
+/*! \note The mutex must be held. */
+void WriteEvent(const Tracer::Event& iEvent, const int iThreadID) {
+  std::fputs(sFirstEvent ? "\n" : ",\n", sFile);
+  sFirstEvent = false;
+
+  switch (iEvent._type) {
+    case Tracer::EventType::SPAN:
+      std::fprintf(sFile,
+                   "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                   "\"pid\":1,\"tid\":%d}",
+                   iEvent._name,
+                   ::ToMicroseconds(iEvent._start - kOrigin),
+                   ::ToMicroseconds(iEvent._end - iEvent._start),
+                   iThreadID);
+      break;
+    case Tracer::EventType::COUNTER:
+      std::fprintf(sFile,
+                   "{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":1,"
+                   "\"tid\":%d,\"args\":{\"value\":%g}}",
+                   iEvent._name,
+                   ::ToMicroseconds(iEvent._start - kOrigin),
+                   iThreadID,
+                   iEvent._value);
+      break;
+    case Tracer::EventType::THREAD_NAME:
+      std::fprintf(sFile,
+                   "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+                   "\"tid\":%d,\"args\":{\"name\":\"%s\"}}",
+                   iThreadID,
+                   iEvent._name);
+      break;
+  }
+}
+
+/*! \note The mutex must be held. */
+void Drain() {
+  for (const auto& ring : sRings) {
+    const std::uint64_t head = ring->_head.load(std::memory_order_acquire);
+    std::uint64_t tail = ring->_tail.load(std::memory_order_relaxed);
+    for (; tail != head; ++tail) {
+      ::WriteEvent(ring->_events[tail % kRingCapacity], ring->_threadID);
+    }
+    ring->_tail.store(tail, std::memory_order_release);
+  }
+  std::fflush(sFile);
+}
+
+void FlushLoop() {
+  std::unique_lock<std::mutex> lock(sMutex);
+  while (!sStopping) {
+    sFlushCondition.wait_for(lock, kPeriodFlush);
+    ::Drain();
+  }
+}
+
+}  // anonymous namespace
+
+namespace aimaze2 {
+
+bool Tracer::Start(const char* iFilePath) {
+  if constexpr (!kEnabled) {
+    return true;
+  }
+
+  std::lock_guard<std::mutex> lock(::sMutex);
+  if (::sFile != nullptr) {
+    return true;
+  }
+
+  ::sFile = std::fopen(iFilePath, "w");
+  if (::sFile == nullptr) {
+    return false;
+  }
+  std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", ::sFile);
+  ::sFirstEvent = true;
+  ::sStopping = false;
+  ::sFlushThread = std::thread{::FlushLoop};
+  return true;
+}
+
+void Tracer::Stop() {
+  if (::sFlushThread.joinable() == false) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(::sMutex);
+    ::sStopping = true;
+  }
+  ::sFlushCondition.notify_one();
+  ::sFlushThread.join();
+
+  std::lock_guard<std::mutex> lock(::sMutex);
+  for (const auto& ring : ::sRings) {
+    const auto numDropped = ring->_numDropped.load(std::memory_order_relaxed);
+    if (numDropped > 0) {
+      std::fprintf(::sFile,
+                   ",\n{\"name\":\"Dropped events\",\"ph\":\"i\",\"s\":\"t\","
+                   "\"ts\":0,\"pid\":1,\"tid\":%d,\"args\":{\"count\":%llu}}",
+                   ring->_threadID,
+                   static_cast<unsigned long long>(numDropped));
+    }
+  }
+  std::fputs("\n]}\n", ::sFile);
+  std::fclose(::sFile);
+  ::sFile = nullptr;
+}
+
+void Tracer::AddEvent(const Event& iEvent) noexcept {
+  thread_local Ring* const tRing = ::RegisterThread();
+
+  const std::uint64_t head = tRing->_head.load(std::memory_order_relaxed);
+  if (head - tRing->_tail.load(std::memory_order_acquire) >= kRingCapacity) {
+    tRing->_numDropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+  tRing->_events[head % kRingCapacity] = iEvent;
+  tRing->_head.store(head + 1, std::memory_order_release);
+}
+
+}  // namespace aimaze2
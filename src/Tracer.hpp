@@ -0,0 +1,106 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__TRACER__HPP
+#define AIMAZE2__TRACER__HPP
+#include <chrono>
+#include <cstdint>
+
+namespace aimaze2 {
+
+/*! \brief Trace events in the Chrome JSON format (chrome://tracing or
+ *         ui.perfetto.dev).
+ *  \note Each thread records into its own ring buffer, a background thread
+ *        drains them into the file between `Start` and `Stop`. Events are
+ *        dropped when a ring buffer is full.
+ *        Names must be string literals: only their address is recorded.
+ *        With kEnabled false nothing is recorded.
+ */
+class Tracer {
+ public:
+  static constexpr bool kEnabled = false;
+
+  using Clock = std::chrono::steady_clock;
+
+  enum class EventType : std::uint8_t { SPAN, COUNTER, THREAD_NAME };
+
+  struct Event {
+    EventType _type;
+    const char* _name;
+    Clock::time_point _start;
+    Clock::time_point _end;
+    double _value;
+  };
+
+  /*! \brief Records its lifetime as a span of the calling thread. */
+  class Span {
+   public:
+    explicit Span(const char* iName) noexcept {
+      if constexpr (kEnabled) {
+        _name = iName;
+        _start = Clock::now();
+      }
+    }
+
+    ~Span() {
+      if constexpr (kEnabled) {
+        AddSpan(_name, _start, Clock::now());
+      }
+    }
+
+    Span(const Span&) = delete;
+    Span& operator=(const Span&) = delete;
+
+   private:
+    const char* _name;
+    Clock::time_point _start;
+  };
+
+  /*! \return false if the file cannot be opened. */
+  static bool Start(const char* iFilePath);
+
+  /*! \brief Writes the pending events and closes the file. */
+  static void Stop();
+
+  /*! \brief Names the calling thread in the trace. */
+  static void SetThreadName(const char* iName) noexcept {
+    if constexpr (kEnabled) {
+      AddEvent(Event{EventType::THREAD_NAME, iName, {}, {}, 0.0});
+    }
+  }
+
+  static void AddCounter(const char* iName, const double iValue) noexcept {
+    if constexpr (kEnabled) {
+      AddEvent(Event{EventType::COUNTER, iName, Clock::now(), {}, iValue});
+    }
+  }
+
+  static void AddSpan(const char* iName,
+                      const Clock::time_point iStart,
+                      const Clock::time_point iEnd) noexcept {
+    if constexpr (kEnabled) {
+      AddEvent(Event{EventType::SPAN, iName, iStart, iEnd, 0.0});
+    }
+  }
+
+ private:
+  static void AddEvent(const Event& iEvent) noexcept;
+};
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__TRACER__HPP
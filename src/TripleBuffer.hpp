@@ -0,0 +1,80 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#ifndef AIMAZE2__TRIPLE_BUFFER__HPP
+#define AIMAZE2__TRIPLE_BUFFER__HPP
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace aimaze2 {
+
+/*! \brief Lock-free hand-off of the latest value from one writer to one reader.
+ *  \note The writer fills the write buffer and publishes it; the reader
+ *        fetches the latest published one. Neither ever waits for the other:
+ *        intermediate values are dropped when the reader is slower.
+ */
+template <typename T>
+class TripleBuffer {
+ public:
+  T* getWriteBuffer() noexcept;
+  void publish() noexcept;
+
+  /*! \brief Returns true if a new value has been published since last fetch. */
+  bool fetch() noexcept;
+  const T& getReadBuffer() const noexcept;
+
+ private:
+  static constexpr std::uint8_t kMaskIndex = 0x03;
+  static constexpr std::uint8_t kFlagFresh = 0x04;
+
+  std::array<T, 3> _buffers;
+  std::uint8_t _indexWrite = 0;
+  std::atomic<std::uint8_t> _indexMiddle{1};
+  std::uint8_t _indexRead = 2;
+};
+
+template <typename T>
+T* TripleBuffer<T>::getWriteBuffer() noexcept {
+  return &_buffers[_indexWrite];
+}
+
+template <typename T>
+void TripleBuffer<T>::publish() noexcept {
+  _indexWrite = _indexMiddle.exchange(_indexWrite | kFlagFresh,
+                                      std::memory_order_acq_rel) &
+                kMaskIndex;
+}
+
+template <typename T>
+bool TripleBuffer<T>::fetch() noexcept {
+  if ((_indexMiddle.load(std::memory_order_relaxed) & kFlagFresh) == 0) {
+    return false;
+  }
+  _indexRead =
+      _indexMiddle.exchange(_indexRead, std::memory_order_acq_rel) & kMaskIndex;
+  return true;
+}
+
+template <typename T>
+const T& TripleBuffer<T>::getReadBuffer() const noexcept {
+  return _buffers[_indexRead];
+}
+
+}  // namespace aimaze2
+
+#endif  // AIMAZE2__TRIPLE_BUFFER__HPP
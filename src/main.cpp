@@ -15,11 +15,96 @@
   along with this program.  If not, see <http://www.gnu.org/licenses/>.
 
 */
+#include <charconv>
+#include <cstring>
+#include <iostream>
+#include <string_view>
 #include "AIMaze.hpp"
 
-int main(int, char*[]) {
+namespace {
+
+constexpr int kNumGenerationsBenchmark = 10;
+
+constexpr const char* kUsage =
+    "Usage: aimaze2 [options]\n"
+    "  --benchmark        Run headless as fast as possible, then print the\n"
+    "                     throughput and exit (default: 10 generations)\n"
+    "  --generations <n>  Exit after n generations\n"
+    "  --seed <n>         Seed of the random engine\n"
+    "  --population <n>   Number of genomes\n"
+    "  --max-ticks <n>    Ticks after which a generation is stopped\n"
+    "  --lockstep         Step every tick, without skipping idle ones\n"
+    "  --mem-report       Print the memory usage of each generation\n"
+    "  --metrics-socket <path>\n"
+    "                     Serve live metrics on a UNIX socket\n"
+    "  --digest-log <path>\n"
+    "                     Log the digest of the scene after each tick\n"
+    "  --help             Print this message\n";
+
+template <typename T>
+bool ParseNumber(const char* iText, T* oValue) {
+  const char* end = iText + std::strlen(iText);
+  const auto [ptr, error] = std::from_chars(iText, end, *oValue);
+  return error == std::errc{} && ptr == end;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char* argv[]) {
   using aimaze2::AIMaze;
 
-  AIMaze{}.launch();
+  AIMaze::Options options;
+  bool validOptions = true;
+  for (int i = 1; i < argc; ++i) {
+    const std::string_view option = argv[i];
+    const char* value = i + 1 < argc ? argv[i + 1] : "";
+
+    if (option == "--help") {
+      std::cout << ::kUsage;
+      return 0;
+    } else if (option == "--mem-report") {
+      options._memoryReport = true;
+    } else if (option == "--benchmark") {
+      options._benchmark = true;
+    } else if (option == "--lockstep") {
+      options._lockstep = true;
+    } else if (option == "--generations") {
+      validOptions = ::ParseNumber(value, &options._numGenerations);
+      ++i;
+    } else if (option == "--seed") {
+      aimaze2::Config::RndEngine::result_type seed;
+      validOptions = ::ParseNumber(value, &seed);
+      options._seed = seed;
+      ++i;
+    } else if (option == "--population") {
+      validOptions = ::ParseNumber(value, &options._sizePopulation) &&
+                     options._sizePopulation > 0;
+      ++i;
+    } else if (option == "--max-ticks") {
+      validOptions = ::ParseNumber(value, &options._maxTicks);
+      ++i;
+    } else if (option == "--digest-log") {
+      options._digestLog = value;
+      validOptions = !options._digestLog.empty();
+      ++i;
+    } else if (option == "--metrics-socket") {
+      options._metricsSocket = value;
+      validOptions = !options._metricsSocket.empty();
+      ++i;
+    } else {
+      validOptions = false;
+    }
+
+    if (!validOptions) {
+      std::cerr << "Invalid option '" << option << "'\n" << ::kUsage;
+      return 1;
+    }
+  }
+
+  if (options._benchmark && options._numGenerations <= 0) {
+    options._numGenerations = ::kNumGenerationsBenchmark;
+  }
+
+  AIMaze{}.launch(options);
   return 0;
 }
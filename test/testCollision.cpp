@@ -0,0 +1,182 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include <gtest/gtest.h>
+#include <CollisionManager.hpp>
+#include <Config.hpp>
+#include <array>
+
+namespace {
+
+using aimaze2::Config;
+using aimaze2::Obstacle;
+using aimaze2::Player;
+
+constexpr float kGameVelocity = 400.f;
+
+// The displacement of an obstacle at 2000 px/s in one tick at 10 Hz.
+constexpr float kLowRateVelocity =
+    2000.f * 0.1f / Config::kDeltaTimeLogicUpdate;
+
+// Gap between the player and an obstacle right in front of it.
+constexpr float kGapAhead = 10.f;
+
+/*! \brief A medium bird flying over the player, which stands on the ground.
+ *  \note Its collision box is between the heads of a standing and of a
+ *        ducking player.
+ */
+void InitBirdOverPlayer(Player* oPlayer, Obstacle* oBird) {
+  oPlayer->init();
+  oPlayer->update(::kGameVelocity);
+
+  oBird->init(Obstacle::ObstacleType::BIRD_MEDIUM);
+  const float distance =
+      Config::kWindowWidth - Player::kPlayerPosition.x + 10.f;
+  oBird->advance(::kGameVelocity,
+                 static_cast<int>(distance / (::kGameVelocity *
+                                              Config::kDeltaTimeLogicUpdate)));
+}
+
+/*! \brief Moves the obstacle to `kGapAhead` pixels in front of the player.
+ */
+void PlaceAhead(const Player& iPlayer, Obstacle* ioObstacle) {
+  const auto playerBox = iPlayer.getCollisionBox();
+  const float distance = ioObstacle->getCollisionBox().left -
+                         (playerBox.left + playerBox.width) - ::kGapAhead;
+  const float distancePerTick = ::kGameVelocity * Config::kDeltaTimeLogicUpdate;
+  ioObstacle->advance(::kGameVelocity,
+                      static_cast<int>(distance / distancePerTick));
+}
+
+/*! \brief A single low-rate tick which moves the obstacle from in front of
+ *         the player to behind it.
+ */
+void PassBehind(Player* ioPlayer, Obstacle* ioObstacle) {
+  const auto playerBox = ioPlayer->getCollisionBox();
+  const auto obstacleBox = ioObstacle->getCollisionBox();
+  ASSERT_GT(::kLowRateVelocity * Config::kDeltaTimeLogicUpdate,
+            obstacleBox.left + obstacleBox.width - playerBox.left);
+
+  ioObstacle->update(::kLowRateVelocity);
+  ioPlayer->update(::kLowRateVelocity);
+  ASSERT_LT(ioObstacle->getCollisionBox().left +
+                ioObstacle->getCollisionBox().width,
+            ioPlayer->getCollisionBox().left);
+}
+
+/*! \return Whether the vertical extents of the boxes overlap. */
+bool OverlapVertically(const sf::FloatRect& iBoxA,
+                       const sf::FloatRect& iBoxB) noexcept {
+  return iBoxA.top < iBoxB.top + iBoxB.height &&
+         iBoxB.top < iBoxA.top + iBoxA.height;
+}
+
+}  // anonymous namespace
+
+namespace aimaze2::testing {
+
+TEST(TestCollision, StandUnderBird) {
+  Player player;
+  Obstacle bird;
+  ::InitBirdOverPlayer(&player, &bird);
+
+  bird.update(::kGameVelocity);
+  player.update(::kGameVelocity);
+
+  const std::array<Obstacle, 1> obstacles{bird};
+  ASSERT_TRUE(CollisionManager::playerCollided(player, obstacles));
+  ASSERT_TRUE(CollisionManager::playerSweptCollided(player, obstacles));
+}
+
+TEST(TestCollision, DuckUnderBird) {
+  Player player;
+  Obstacle bird;
+  ::InitBirdOverPlayer(&player, &bird);
+
+  // Ducking lowers the player at once, during the tick.
+  player.duckOn();
+  bird.update(::kGameVelocity);
+  player.update(::kGameVelocity);
+
+  const std::array<Obstacle, 1> obstacles{bird};
+  ASSERT_FALSE(CollisionManager::playerCollided(player, obstacles));
+  ASSERT_FALSE(CollisionManager::playerSweptCollided(player, obstacles));
+}
+
+TEST(TestCollision, TunnelThroughPlayer) {
+  Player player;
+  player.init();
+  player.update(::kGameVelocity);
+  Obstacle cactus;
+  cactus.init(Obstacle::ObstacleType::CACTUS_BIG);
+  ::PlaceAhead(player, &cactus);
+
+  ::PassBehind(&player, &cactus);
+
+  const std::array<Obstacle, 1> obstacles{cactus};
+  ASSERT_FALSE(CollisionManager::playerCollided(player, obstacles));
+  ASSERT_TRUE(CollisionManager::playerSweptCollided(player, obstacles));
+}
+
+TEST(TestCollision, JumpIntoBird) {
+  Player player;
+  player.init();
+  player.update(::kGameVelocity);
+  Obstacle bird;
+  bird.init(Obstacle::ObstacleType::BIRD_HIGH);
+
+  // Rising, the player reaches the altitude of the bird.
+  player.jump();
+  while (!::OverlapVertically(player.getCollisionBox(),
+                              bird.getCollisionBox())) {
+    ASSERT_LT(player.getVelocityY(), 0.f);
+    player.update(::kGameVelocity);
+  }
+  ::PlaceAhead(player, &bird);
+
+  ::PassBehind(&player, &bird);
+
+  const std::array<Obstacle, 1> obstacles{bird};
+  ASSERT_FALSE(CollisionManager::playerCollided(player, obstacles));
+  ASSERT_TRUE(CollisionManager::playerSweptCollided(player, obstacles));
+}
+
+TEST(TestCollision, JumpOverCactus) {
+  Player player;
+  player.init();
+  player.update(::kGameVelocity);
+  Obstacle cactus;
+  cactus.init(Obstacle::ObstacleType::CACTUS_BIG);
+
+  // At the top of the arc the player is well above the cactus.
+  player.jump();
+  while (player.getVelocityY() < 0.f) {
+    player.update(::kGameVelocity);
+  }
+  ASSERT_TRUE(player.isJumping());
+  ASSERT_FALSE(::OverlapVertically(player.getCollisionBox(),
+                                   cactus.getCollisionBox()));
+  ::PlaceAhead(player, &cactus);
+
+  ::PassBehind(&player, &cactus);
+
+  const std::array<Obstacle, 1> obstacles{cactus};
+  ASSERT_FALSE(CollisionManager::playerCollided(player, obstacles));
+  ASSERT_FALSE(CollisionManager::playerSweptCollided(player, obstacles));
+}
+
+}  // namespace aimaze2::testing
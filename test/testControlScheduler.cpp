@@ -0,0 +1,106 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include <gtest/gtest.h>
+#include <ControlScheduler.hpp>
+
+namespace aimaze2::testing {
+
+TEST(TestControlScheduler, EveryTick) {
+  ControlScheduler scheduler;
+  scheduler.init(1, true);
+
+  ASSERT_EQ(scheduler.getPeriodTicks(), 1);
+  for (std::size_t player = 0; player < 3; ++player) {
+    ASSERT_EQ(scheduler.computePhase(player), 0);
+    for (std::size_t tick = 0; tick < 5; ++tick) {
+      ASSERT_TRUE(scheduler.isDecisionTick(player, tick));
+    }
+  }
+}
+
+TEST(TestControlScheduler, Staggered) {
+  constexpr int kPeriod = 4;
+  ControlScheduler scheduler;
+  scheduler.init(kPeriod, true);
+
+  ASSERT_EQ(scheduler.computePhase(0), 0);
+  ASSERT_EQ(scheduler.computePhase(1), 1);
+  ASSERT_EQ(scheduler.computePhase(3), 3);
+  ASSERT_EQ(scheduler.computePhase(4), 0);
+  ASSERT_EQ(scheduler.computePhase(9), 1);
+
+  // Each player decides once per period, on the tick of its phase.
+  for (std::size_t player = 0; player < 8; ++player) {
+    for (std::size_t tick = 0; tick < 3 * kPeriod; ++tick) {
+      ASSERT_EQ(scheduler.isDecisionTick(player, tick),
+                tick % kPeriod == player % kPeriod);
+    }
+  }
+
+  // The population is evenly spread over the ticks of the period.
+  for (std::size_t tick = 0; tick < kPeriod; ++tick) {
+    int numDecisions = 0;
+    for (std::size_t player = 0; player < 2 * kPeriod; ++player) {
+      numDecisions += scheduler.isDecisionTick(player, tick) ? 1 : 0;
+    }
+    ASSERT_EQ(numDecisions, 2);
+  }
+}
+
+TEST(TestControlScheduler, NotStaggered) {
+  constexpr int kPeriod = 4;
+  ControlScheduler scheduler;
+  scheduler.init(kPeriod, false);
+
+  for (std::size_t player = 0; player < 8; ++player) {
+    ASSERT_EQ(scheduler.computePhase(player), 0);
+    for (std::size_t tick = 0; tick < 3 * kPeriod; ++tick) {
+      ASSERT_EQ(scheduler.isDecisionTick(player, tick), tick % kPeriod == 0);
+    }
+  }
+}
+
+TEST(TestControlScheduler, Stats) {
+  ControlScheduler scheduler;
+  scheduler.init(2, true);
+  ASSERT_EQ(scheduler.getNumEvaluations(), 0);
+  ASSERT_EQ(scheduler.getNumAudits(), 0);
+  ASSERT_EQ(scheduler.getNumMismatches(), 0);
+
+  scheduler.addEvaluation();
+  scheduler.addEvaluation();
+  scheduler.addAudit(false);
+  scheduler.addAudit(true);
+  scheduler.addAudit(true);
+  ASSERT_EQ(scheduler.getNumEvaluations(), 2);
+  ASSERT_EQ(scheduler.getNumAudits(), 3);
+  ASSERT_EQ(scheduler.getNumMismatches(), 2);
+
+  scheduler.resetStats();
+  ASSERT_EQ(scheduler.getNumEvaluations(), 0);
+  ASSERT_EQ(scheduler.getNumAudits(), 0);
+  ASSERT_EQ(scheduler.getNumMismatches(), 0);
+
+  // A new init starts from zero as well.
+  scheduler.addEvaluation();
+  scheduler.init(3, false);
+  ASSERT_EQ(scheduler.getNumEvaluations(), 0);
+  ASSERT_EQ(scheduler.getPeriodTicks(), 3);
+}
+
+}  // namespace aimaze2::testing
@@ -0,0 +1,95 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include <gtest/gtest.h>
+#include <FitnessCache.hpp>
+
+namespace aimaze2::testing {
+
+namespace {
+
+const FitnessCache::Key kKey{0x1234, 42, 4, 1};
+
+}  // anonymous namespace
+
+TEST(TestFitnessCache, MatchesAfterFlush) {
+  FitnessCache cache;
+  cache.addOutcome(kKey, 300);
+  ASSERT_FALSE(cache.matches(kKey, nullptr));
+
+  cache.flush();
+  std::size_t deathTick = 0;
+  ASSERT_TRUE(cache.matches(kKey, &deathTick));
+  ASSERT_EQ(deathTick, 300u);
+  ASSERT_EQ(cache.size(), 1u);
+}
+
+TEST(TestFitnessCache, MissOnEachKeyField) {
+  FitnessCache cache;
+  cache.addOutcome(kKey, 300);
+  cache.flush();
+
+  FitnessCache::Key key = kKey;
+  key._genomeHash += 1;
+  ASSERT_FALSE(cache.matches(key, nullptr));
+
+  key = kKey;
+  key._courseSeed += 1;
+  ASSERT_FALSE(cache.matches(key, nullptr));
+
+  key = kKey;
+  key._controlPeriod += 1;
+  ASSERT_FALSE(cache.matches(key, nullptr));
+
+  // Same genome and period, but it decides on other ticks.
+  key = kKey;
+  key._controlPhase += 1;
+  ASSERT_FALSE(cache.matches(key, nullptr));
+
+  ASSERT_TRUE(cache.matches(kKey, nullptr));
+}
+
+TEST(TestFitnessCache, FlushKeepsLastGeneration) {
+  const FitnessCache::Key kOtherKey{0x5678, 42, 4, 1};
+
+  FitnessCache cache;
+  cache.addOutcome(kKey, 300);
+  cache.addOutcome(kOtherKey, 500);
+  cache.flush();
+  ASSERT_EQ(cache.size(), 2u);
+
+  // Next generation: only kKey is evaluated again (with a hit).
+  std::size_t deathTick = 0;
+  ASSERT_TRUE(cache.matches(kKey, &deathTick));
+  cache.addOutcome(kKey, deathTick);
+
+  // Outcomes of the running generation are not visible until the flush.
+  ASSERT_TRUE(cache.matches(kOtherKey, nullptr));
+  cache.flush();
+
+  ASSERT_EQ(cache.size(), 1u);
+  ASSERT_TRUE(cache.matches(kKey, &deathTick));
+  ASSERT_EQ(deathTick, 300u);
+  ASSERT_FALSE(cache.matches(kOtherKey, nullptr));
+
+  // A generation without outcomes empties the cache.
+  cache.flush();
+  ASSERT_EQ(cache.size(), 0u);
+  ASSERT_FALSE(cache.matches(kKey, nullptr));
+}
+
+}  // namespace aimaze2::testing
@@ -226,4 +226,40 @@ TEST(TestGenome, SameSpecie) {
   ASSERT_TRUE(genomeA.isSameSpecie(genomeAcopy));
 }
 
+TEST(TestGenome, SimilarityWeights) {
+  Genome genomeA = ::BuildGenomeA();
+  Genome genomeAcopy = ::BuildGenomeA();
+  genomeA.sortConnectionsByInnovationNum();
+  genomeAcopy.sortConnectionsByInnovationNum();
+
+  // All the genes match: only the first and the last differ, by weight.
+  constexpr float kWeightDifferenceFirst = 0.25f;
+  constexpr float kWeightDifferenceLast = 0.5f;
+  auto& firstConnection = genomeAcopy.getMutableConnections()->front();
+  firstConnection.setWeight(firstConnection.getWeight() -
+                            kWeightDifferenceFirst);
+  auto& lastConnection = genomeAcopy.getMutableConnections()->back();
+  lastConnection.setWeight(lastConnection.getWeight() - kWeightDifferenceLast);
+
+  const float numMatching = static_cast<float>(genomeA.getNumConnections());
+  ASSERT_FLOAT_EQ(
+      Genome::computeSimilaritySpecie(genomeA, genomeAcopy),
+      ConfigEvolution::kWeightsCoefficient *
+          (kWeightDifferenceFirst + kWeightDifferenceLast) / numMatching);
+}
+
+TEST(TestGenome, ContentHash) {
+  Genome genomeA = ::BuildGenomeA();
+  Genome genomeAcopy = ::BuildGenomeA();
+  Genome genomeB = ::BuildGenomeB();
+
+  ASSERT_EQ(genomeA.computeContentHash(), genomeAcopy.computeContentHash());
+  ASSERT_TRUE(genomeA.hasSameContent(genomeAcopy));
+  ASSERT_FALSE(genomeA.hasSameContent(genomeB));
+
+  genomeAcopy.getMutableConnections()->front().setWeight(0.5f);
+  ASSERT_NE(genomeA.computeContentHash(), genomeAcopy.computeContentHash());
+  ASSERT_FALSE(genomeA.hasSameContent(genomeAcopy));
+}
+
 }  // namespace aimaze2::testing
@@ -0,0 +1,115 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include <gtest/gtest.h>
+#include <GameScene.hpp>
+#include <ObstacleManager.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace {
+
+using aimaze2::Config;
+using aimaze2::GameScene;
+using aimaze2::ObstacleManager;
+
+constexpr ObstacleManager::SeedType kSeed = 42;
+constexpr float kGameVelocity = 400.f;
+constexpr std::size_t kDeathTickMemoized = 30000;
+constexpr int kMaxIdleTicks = 1000;
+
+/*! \brief Obstacles spawned a few pixels apart.
+ *  \note At a crawling velocity the spawn time is far away: the timer
+ *        accumulates until it is due at the regular velocity.
+ */
+void SpawnCluster(const int iNumObstacles, ObstacleManager* ioManager) {
+  constexpr float kCrawlingVelocity = 1.f;
+
+  for (int i = 0; i < iNumObstacles; ++i) {
+    while (ioManager->computeTicksToSpawn(::kGameVelocity, 1) != 0) {
+      ioManager->update(kCrawlingVelocity);
+    }
+    ioManager->update(::kGameVelocity);
+  }
+}
+
+}  // anonymous namespace
+
+namespace aimaze2::testing {
+
+TEST(TestIdleStepping, ObstaclesLeaveInOneStep) {
+  constexpr int kNumObstacles = 3;
+
+  ObstacleManager stepped;
+  stepped.init(::kSeed);
+  ::SpawnCluster(kNumObstacles, &stepped);
+  ASSERT_EQ(stepped.getObstacles().size(), kNumObstacles);
+  ObstacleManager reference = stepped;
+
+  const int numTicks = stepped.computeTicksToSpawn(
+      ::kGameVelocity, std::numeric_limits<int>::max());
+  ASSERT_GT(numTicks * ::kGameVelocity * Config::kDeltaTimeLogicUpdate,
+            static_cast<float>(Config::kWindowWidth));
+
+  stepped.advance(::kGameVelocity, numTicks);
+  for (int i = 0; i < numTicks; ++i) {
+    reference.update(::kGameVelocity);
+  }
+
+  ASSERT_TRUE(reference.getObstacles().empty());
+  ASSERT_TRUE(stepped.getObstacles().empty());
+}
+
+TEST(TestIdleStepping, SameDigestsAsUpdate) {
+  Config::RndEngine rndEngineStepped(::kSeed);
+  Config::RndEngine rndEngineReference(::kSeed);
+  GameScene stepped;
+  GameScene reference;
+
+  // The memoized player keeps the scene running once the other is dead,
+  // when idle steps span several obstacles.
+  stepped.init(2, ::kSeed, &rndEngineStepped);
+  reference.init(2, ::kSeed, &rndEngineReference);
+  stepped.setPlayerMemoized(1, ::kDeathTickMemoized);
+  reference.setPlayerMemoized(1, ::kDeathTickMemoized);
+
+  int maxIdleTicks = 0;
+  while (!reference.arePlayersAllDead()) {
+    const int idleTicks = stepped.computeIdleTicks(::kMaxIdleTicks);
+    if (idleTicks > 0) {
+      stepped.advanceIdle(idleTicks);
+      for (int i = 0; i < idleTicks; ++i) {
+        reference.update(&rndEngineReference);
+      }
+    } else {
+      stepped.update(&rndEngineStepped);
+      reference.update(&rndEngineReference);
+    }
+    maxIdleTicks = std::max(maxIdleTicks, idleTicks);
+
+    ASSERT_EQ(stepped.getNumTicks(), reference.getNumTicks());
+    ASSERT_EQ(stepped.computeStateDigest(), reference.computeStateDigest())
+        << "at tick " << reference.getNumTicks();
+  }
+
+  ASSERT_TRUE(stepped.arePlayersAllDead());
+  ASSERT_EQ(reference.getNumTicks(), ::kDeathTickMemoized);
+  ASSERT_GT(stepped.getNumIdleTicks(), reference.getNumTicks() / 2);
+  ASSERT_GT(maxIdleTicks, 1);
+}
+
+}  // namespace aimaze2::testing
@@ -45,4 +45,35 @@ TEST(TestPopulation, NaturalSelection) {
   ASSERT_EQ(population.getPopulationSize(), kSizePopulation);
 }
 
+TEST(TestPopulation, UniqueGenomes) {
+  Population population;
+  population.init(::kSizePopulation, ::kNumInputs, ::kNumOutputs);
+
+  std::vector<std::size_t> uniqueGenomes;
+  std::vector<std::size_t> groups;
+  population.computeUniqueGenomes(&uniqueGenomes, &groups);
+
+  ASSERT_EQ(uniqueGenomes.size(), 1u);
+  ASSERT_EQ(groups, std::vector<std::size_t>(::kSizePopulation, 0));
+}
+
+TEST(TestPopulation, MemoryUsage) {
+  Population population;
+  population.init(::kSizePopulation, ::kNumInputs, ::kNumOutputs);
+
+  std::size_t genomes;
+  std::size_t species;
+  std::size_t innovationHistory;
+  population.computeMemoryUsage(&genomes, &species, &innovationHistory);
+  const std::size_t minGenomeSize =
+      sizeof(Genome) + population.getGenome(0).getTotalNumNodes() *
+                           sizeof(GeneNode);
+  ASSERT_GE(genomes, ::kSizePopulation * minGenomeSize);
+
+  population.setAllFitness(kFitness);
+  population.naturalSelection(&sRndEngine);
+  population.computeMemoryUsage(&genomes, &species, &innovationHistory);
+  ASSERT_GE(species, population.getSpeciesSize() * sizeof(Species));
+}
+
 }  // namespace aimaze2::testing
@@ -0,0 +1,148 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+namespace {
+
+constexpr const char* kUsage =
+    "Usage: aimaze2_compare_digests <digest log A> <digest log B>\n"
+    "Reports the first tick where the scenes of two runs diverge.\n"
+    "Ticks logged by one run only (e.g. skipped as idle) are not compared.\n";
+
+struct Entry {
+  int _generationNum = 0;
+  std::uint64_t _tick = 0;
+  std::uint64_t _digest = 0;
+
+  bool operator<(const Entry& iOther) const noexcept {
+    return std::tie(_generationNum, _tick) <
+           std::tie(iOther._generationNum, iOther._tick);
+  }
+};
+
+/*! \brief Reads the digest log written with `aimaze2 --digest-log`. */
+class DigestLog {
+ public:
+  bool open(const char* iFilePath) {
+    _file.open(iFilePath);
+    return _file.is_open();
+  }
+
+  /*! \brief The seed in the header, empty if missing. */
+  const std::string& getSeed() const noexcept { return _seed; }
+
+  /*! \return false at the end of the file. */
+  bool next(Entry* oEntry) {
+    std::string line;
+    while (std::getline(_file, line)) {
+      if (line.rfind("# seed ", 0) == 0) {
+        _seed = line.substr(7);
+        continue;
+      }
+      if (line.empty() || line[0] == '#') {
+        continue;
+      }
+
+      std::istringstream fields{line};
+      if (fields >> oEntry->_generationNum >> oEntry->_tick >> std::hex >>
+          oEntry->_digest) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  std::ifstream _file;
+  std::string _seed;
+};
+
+void PrintEntry(const Entry& iEntry) {
+  std::cout << "generation " << iEntry._generationNum << ", tick "
+            << iEntry._tick;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char* argv[]) {
+  if (argc != 3) {
+    std::cerr << ::kUsage;
+    return 2;
+  }
+
+  ::DigestLog logA;
+  ::DigestLog logB;
+  if (!logA.open(argv[1]) || !logB.open(argv[2])) {
+    std::cerr << "Cannot open the digest logs\n";
+    return 2;
+  }
+
+  ::Entry entryA;
+  ::Entry entryB;
+  bool hasA = logA.next(&entryA);
+  bool hasB = logB.next(&entryB);
+  if (logA.getSeed() != logB.getSeed()) {
+    std::cout << "Warning: the runs have different seeds ("
+              << logA.getSeed() << ", " << logB.getSeed() << ")\n";
+  }
+
+  std::size_t numCompared = 0;
+  ::Entry lastMatch;
+  while (hasA && hasB) {
+    if (entryA < entryB) {
+      hasA = logA.next(&entryA);
+    } else if (entryB < entryA) {
+      hasB = logB.next(&entryB);
+    } else {
+      if (entryA._digest != entryB._digest) {
+        std::cout << "First divergence at ";
+        ::PrintEntry(entryA);
+        std::cout << std::hex << " (" << entryA._digest << " vs "
+                  << entryB._digest << std::dec << ")\n";
+        if (numCompared > 0) {
+          std::cout << "Last match at ";
+          ::PrintEntry(lastMatch);
+          std::cout << '\n';
+        }
+        return 1;
+      }
+
+      lastMatch = entryA;
+      ++numCompared;
+      hasA = logA.next(&entryA);
+      hasB = logB.next(&entryB);
+    }
+  }
+
+  std::cout << "No divergence over " << numCompared << " common ticks";
+  if (numCompared > 0) {
+    std::cout << ", up to ";
+    ::PrintEntry(lastMatch);
+  }
+  std::cout << '\n';
+  if (hasA || hasB) {
+    std::cout << "Run " << (hasA ? 'A' : 'B') << " goes on after the other\n";
+  }
+  return 0;
+}
@@ -0,0 +1,89 @@
+/*
+  Copyright (C) 2019  Biagio Festa
+
+  This program is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  This program is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+*/
+#include <SFML/Graphics.hpp>
+#include <iostream>
+#include "Config.hpp"
+#include "SceneRenderer.hpp"
+#include "SceneSnapshot.hpp"
+#include "SharedScene.hpp"
+
+namespace {
+
+// Without new snapshots for a while the trainer is likely gone or restarted.
+constexpr float kTimeoutSnapshot = 2.f;
+
+}  // anonymous namespace
+
+int main(int, char*[]) {
+  using aimaze2::Config;
+  using aimaze2::SceneRenderer;
+  using aimaze2::SceneSnapshot;
+  using aimaze2::SharedScene;
+
+  sf::RenderWindow renderWindow;
+  renderWindow.create(
+      sf::VideoMode{Config::kWindowWidth, Config::kWindowHeight},
+      std::string{Config::kWindowTitle} + " Viewer");
+  renderWindow.setFramerateLimit(Config::kFPSRenderDraw);
+
+  SceneRenderer sceneRenderer;
+  sceneRenderer.init();
+
+  SharedScene sharedScene;
+  SceneSnapshot snapshot;
+  bool hasSnapshot = false;
+  sf::Clock clockSnapshot;
+
+  std::cout << "Waiting for the trainer on '" << Config::kSharedSceneName
+            << "'\n";
+
+  while (renderWindow.isOpen()) {
+    sf::Event event;
+    while (renderWindow.pollEvent(event)) {
+      if (event.type == sf::Event::EventType::Closed) {
+        renderWindow.close();
+      }
+    }
+
+    if (sharedScene.isAttached() == false &&
+        sharedScene.attach(Config::kSharedSceneName)) {
+      std::cout << "Attached\n";
+      clockSnapshot.restart();
+    }
+
+    if (sharedScene.read(&snapshot)) {
+      hasSnapshot = true;
+      clockSnapshot.restart();
+    } else if (sharedScene.isAttached()) {
+      const float timeWithoutSnapshot =
+          clockSnapshot.getElapsedTime().asSeconds();
+      if (timeWithoutSnapshot > ::kTimeoutSnapshot) {
+        std::cout << "Detached\n";
+        sharedScene.detach();
+      }
+    }
+
+    renderWindow.clear(Config::kRenderBackgroundColor);
+    if (hasSnapshot) {
+      sceneRenderer.draw(snapshot, &renderWindow);
+    }
+    renderWindow.display();
+  }
+
+  return 0;
+}